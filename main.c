@@ -3,482 +3,18187 @@
 #include "genalg.h"
 #include "genbrush.h"
 #include "string.h"
+#include "time.h"
+#include "stdint.h"
+#include "limits.h"
+#include "fcntl.h"
+#include "unistd.h"
+#include "sys/mman.h"
+#include "sys/stat.h"
+#include "pthread.h"
+#include "errno.h"
+#include "zlib.h"
+#include "signal.h"
+#include "poll.h"
+#include "sys/inotify.h"
+#include "sys/resource.h"
+#if BUILDWITHGRAPHICLIB
+#include "gtk/gtk.h"
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include "immintrin.h"
+#define RASTER_SIMD_X86 1
+#endif
 
 #define GAViewerErr GenAlgErr
 #define DEFAULT_DIMHISTORYIMG 800
 
-typedef struct Node Node;
-typedef struct Node {
+// Multiplier used to hash the ids of nodes (2^64 / golden ratio)
+#define NODEINDEX_HASHMULT 11400714819323198485ull
+
+// Size in bytes of the buffer used to read the history file
+#define HISTREADER_BUFSIZE 65536
+
+// Max length of the keys in the history file
+#define HISTREADER_KEYLENMAX 32
+
+// Magic number and version of the binary history files
+#define GAH_MAGIC "GAH1"
+#define GAH_VERSION 1
+
+// Initial value of the FNV-1a hash of the part of the source history a
+// binary history or a layout cache comes from, used to check it hasn't
+// been modified
+#define GAH_HASHSEED 14695981039346656037ull
+
+// Magic number, version and extension of the epoch index files
+#define GAI_MAGIC "GAI1"
+#define GAI_VERSION 2
+#define GAI_EXT ".gai"
+
+// Magic number, version and extension of the layout cache files, and
+// nb of epochs between two checkpoints of the layout
+#define GAL_MAGIC "GAL1"
+#define GAL_VERSION 1
+#define GAL_EXT ".gal"
+#define GAL_CHECKPOINT 256
+
+// Magic number, version and extension of the out-of-core layout files
+#define GAO_MAGIC "GAO1"
+#define GAO_VERSION 1
+#define GAO_EXT ".gao"
+
+// Flag of the father of the nodes of the out-of-core layout files
+// meaning the node is a survivor, and value of the father meaning the
+// node has no father in the previous epoch
+#define GAO_SURVIVE 0x80000000u
+#define GAO_NOFATHER 0x7FFFFFFFu
+
+// Nb of births buffered by the out-of-core mode before they are sorted
+// by epoch and written as a run file
+#define OOC_NBBIRTHRUN 1048576
+
+// Index of node meaning there is no node
+#define NODE_NONE UINT32_MAX
+
+// Nb of values of the digits of the radix sort of the ids (16 bits)
+#define RANKSORT_NBDIGIT 65536
+
+// Nb of tiles per thread when the image is drawn by several threads
+#define RENDER_TILEPERTHREAD 8
+
+// Size in pixels of the tiles of the image pyramid, and of the image at
+// the most detailed level: width per epoch, height per node of the
+// largest epoch and min and max height
+#define TILES_SIZE 256
+#define TILES_WIDTHEPOCH 32
+#define TILES_HEIGHTNODE 4
+#define TILES_HEIGHTMIN 256
+#define TILES_HEIGHTMAX 32768
+
+// Name of the manifest and of the directory of tiles of the image
+// pyramid
+#define TILES_NAME "genealogy"
+
+// Size in bytes of the raw rows of the strips encoded by an ImgWriter,
+// and of the deflate dictionary (max window of deflate)
+#define IMGWRITER_SIZESTRIP 262144
+#define IMGWRITER_SIZEDICT 32768
+
+// Max size in pixels of the sides of a TGA image (16 bits)
+#define IMGWRITER_SIZETGAMAX 65535
+
+// Size in bytes of the strips of pixels drawn by the strips renderer
+#define RENDER_SIZESTRIP 67108864
+
+// Size in bytes of the buffer of a SvgWriter
+#define SVGWRITER_SIZEBUFFER 262144
+
+// Factor of the zoom of the interactive window per step of the mouse
+// wheel, max size in pixels of its virtual image (beyond which the
+// positions in float lose their precision), and distance in pixels
+// under which a node is picked by the pointer
+#define WINDOW_ZOOMSTEP 1.25
+#define WINDOW_SIZEIMGMAX 16777216
+#define WINDOW_PICKDIST 4.0
+
+// Max ratio of pixels drawn by a vectorized kernel which may differ from
+// the scalar kernel
+#define RASTER_KERNEL_TOLERANCE 0.001
+
+// Max nb of phases measured by -stats
+#define STATS_NBPHASEMAX 16
+
+// Nb of columns of the distribution of the nb of births per father
+// saved by -statsCsv, the last one counting the fathers of this nb of
+// births or more
+#define STATSCSV_NBOFFSPRING 6
+
+// Add 'nb' to the counter 'counter' of the current thread if the
+// statistics are enabled
+#define STATS_ADD(counter, nb) \
+  do { \
+    if (statsIsEnabled == true) statsCounters.counter += (uint64_t)(nb); \
+  } while (false)
+
+// Pack a color into a pixel of a Raster
+#define RASTER_RGBA(r, g, b, a) \
+  (((uint32_t)(a) << 24) | ((uint32_t)(r) << 16) | \
+  ((uint32_t)(g) << 8) | (uint32_t)(b))
+
+// Birth decoded from the history, waiting to be added to the columns
+// of the NodeStore
+typedef struct NodeBirth {
 
   // Epoch
-  unsigned long epoch;
+  uint32_t epoch;
 
-  // Position of the node in the image
-  VecFloat3D pos;
+  // Id
+  uint32_t id;
 
   // Parents id
-  unsigned long parents[2];
+  uint32_t parents[2];
 
-  // Id
-  unsigned long id;
+} NodeBirth;
 
-  // Rank to sort the nodes
-  unsigned long rank;
+// Store of the nodes as one column per property, the nodes being
+// grouped by epoch and referred to by their index inside their epoch
+// Columns are allocated in a single arena, except the id and parents
+// columns which are used in place when loaded from a binary history
+typedef struct NodeStore {
 
-} Node;
+  // Births added since the columns were built
+  NodeBirth* births;
 
-typedef struct {
+  // Nb of births, and nb of births for which memory is allocated
+  unsigned long nbBirth;
+  unsigned long nbBirthAlloc;
 
-  // Path to the history file
-  char* pathHistory;
+  // Arena holding the columns
+  void* arena;
 
-  // Path to the history image file
-  char* pathHistoryImg;
+  // Binary history mapped in memory and its size, NULL if none
+  void* map;
+  size_t mapSize;
 
-  // Dimensions of the output image for history
-  VecShort2D dimHistoryImg;
+  // Nb of nodes and epochs in the columns
+  unsigned long nbNode;
+  unsigned long nbEpoch;
 
-  // Loaded history
-  GAHistory history;
+  // Nb of nodes, epochs and slots for which the columns are allocated,
+  // the births of the last epochs being appended in place while they
+  // fit in
+  unsigned long nbNodeAlloc;
+  unsigned long nbEpochAlloc;
+  uint64_t nbSlotAlloc;
 
-  // Converted history into GSet of Node, one GSet per epoch
-  // Node are sorted according to the id of their father and their id
-  GSet* nodes;
+  // First ranked epoch, and nb of epochs whose nodes are ranked, the
+  // ranked epochs being 'rankFromEpoch' to 'nbEpochRanked' - 1
+  unsigned long rankFromEpoch;
+  unsigned long nbEpochRanked;
 
-  // Nb of epoch in the history
-  unsigned long nbEpoch;
+  // Index of the first node of each epoch, followed by the nb of
+  // nodes (nbEpoch + 1 values)
+  const uint64_t* first;
 
-  // First displayed epoch
-  unsigned long fromEpoch;
+  // Id of the nodes
+  const uint32_t* id;
 
-  // Last displayed epoch
-  unsigned long toEpoch;
+  // Id of the parents of the nodes
+  const uint32_t* father;
+  const uint32_t* mother;
 
-} GAViewer;
+  // Rank of the nodes in their epoch
+  uint32_t* rank;
 
-// Function to create a new GAViewer,
-// Return a pointer to the new GAViewer
-GAViewer* GAViewerCreate(void);
+  // Index of the nodes in their epoch sorted by rank
+  uint32_t* order;
 
-// Function to free the memory used by the GAViewer 'that'
-void GAViewerFree(GAViewer** const that);
+  // Index of the father of the nodes in the previous epoch, NODE_NONE
+  // if it's not in the previous epoch
+  uint32_t* fatherIdx;
 
-// Process the prior arguments from the command line
-// Return true if the arguments were correct, else false
-bool GAViewerProcessPriorCmdLineArguments(
-     GAViewer* const that,
-           const int argc,
-  const char** const argv);
+  // Index of the first slot of the hash table of each epoch, followed
+  // by the nb of slots (nbEpoch + 1 values). The nb of slots of each
+  // table is a power of 2
+  uint64_t* firstSlot;
 
-// Process the posterior arguments from the command line
-// Return true if the arguments were correct, else false
-bool GAViewerProcessPosteriorCmdLineArguments(
-     GAViewer* const that,
-           const int argc,
-  const char** const argv);
+  // Slots of the hash tables retrieving the nodes of one epoch from
+  // their id, index of the node in its epoch or NODE_NONE if empty
+  uint32_t* slots;
 
-// Create the image from the history
-// Return true if successfull, else false
-bool GAViewerHistoryToImg(GAViewer* const that);
+} NodeStore;
 
-// Create the nodes from the history
-void GAViewerHistoryToNodes(GAViewer* const that);
+// Index of the position of the epochs in the history file, and
+// summary of the history
+typedef struct EpochIndex {
 
-// Get the max id from the history
-unsigned long GAViewerHistoryGetMaxId(GAViewer* const that);
+  // Offset in the history file of the first birth of each epoch
+  uint64_t* offsets;
 
-// Get the nb of epoch from the history
-unsigned long GAViewerHistoryGetNbEpoch(GAViewer* const that);
+  // Nb of births of each epoch
+  uint64_t* nbBirthEpoch;
 
-// Search a node based on its id at a given epoch
-Node* GAViewerSearchNode(
-  const GAViewer* const that,
-          unsigned long epoch,
-          unsigned long id);
+  // Nb of births and max id of births in the history
+  uint64_t nbBirth;
+  uint64_t maxId;
 
-// Function to create a new GAViewer,
-// Return a pointer to the new GAViewer
-GAViewer* GAViewerCreate(void) {
+  // Nb of indexed epochs, and nb of epochs for which memory is
+  // allocated
+  unsigned long nbEpoch;
+  unsigned long nbEpochAlloc;
 
-  // Allocate memory for the CBo
-  GAViewer* that =
-    PBErrMalloc(
-      GAViewerErr,
-      sizeof(GAViewer));
+  // Flag to memorize if the births are grouped by increasing epoch in
+  // the history file, in which case the index can be used to load
+  // a range of epochs
+  bool isSorted;
 
-  // Init the properties
-  that->pathHistory = NULL;
-  that->pathHistoryImg = NULL;
-  that->dimHistoryImg = VecShortCreateStatic2D();
-  VecSet(
-    &(that->dimHistoryImg),
-    0,
-    DEFAULT_DIMHISTORYIMG);
-  VecSet(
-    &(that->dimHistoryImg),
-    1,
-    DEFAULT_DIMHISTORYIMG);
-  that->history = GAHistoryCreateStatic();
-  that->nodes = NULL;
-  that->nbEpoch = 0;
-  that->fromEpoch = 0;
-  that->toEpoch = 0;
+} EpochIndex;
 
-  // Return the new GAViewer
-  return that;
+// Header of the epoch index files (.gai), saved beside the history
+// file and followed by the offsets of the epochs and their nb of
+// births (nbEpoch uint64_t each)
+typedef struct GaiHeader {
 
-}
+  // Magic number, GAI_MAGIC
+  char magic[4];
 
-// Function to free the memory used by the GAViewer 'that'
-void GAViewerFree(GAViewer** const that) {
+  // Version of the format, GAI_VERSION
+  uint32_t version;
 
-  if (that == NULL || *that == NULL) return;
+  // Size and modification time of the indexed history file
+  uint64_t srcSize;
+  int64_t srcMtime;
 
-  // Free memory
-  if ((*that)->pathHistory != NULL) {
+  // Nb of epochs
+  uint64_t nbEpoch;
 
-    free((*that)->pathHistory);
+  // Flag to memorize if the births are grouped by increasing epoch
+  uint64_t isSorted;
 
-  }
+  // Nb of births
+  uint64_t nbBirth;
 
-  if ((*that)->pathHistoryImg != NULL) {
+  // Max id of births
+  uint64_t maxId;
 
-    free((*that)->pathHistoryImg);
+} GaiHeader;
 
-  }
+// Streaming reader of the history file, decoding births on the fly
+// without building the whole JSON tree
+typedef struct HistReader {
 
-  if ((*that)->nodes != NULL) {
+  // Stream of the history file
+  FILE* stream;
 
-    for (
-      unsigned long iEpoch = (*that)->nbEpoch;
-      iEpoch--;) {
+  // Buffer of data read from the stream
+  char buffer[HISTREADER_BUFSIZE];
 
-      GSet* set = (*that)->nodes + iEpoch;
-      while(GSetNbElem(set) > 0) {
+  // Number of bytes in the buffer
+  size_t nbByte;
 
-          Node* node = GSetPop(set);
-          free(node);
+  // Position of the next byte to read in the buffer
+  size_t pos;
 
-      };
+  // Offset in the file of the first byte in the buffer
+  unsigned long offset;
 
-    }
+  // Index of epochs updated while reading, NULL if none
+  EpochIndex* epochIndex;
 
-    free((*that)->nodes);
+  // Flag to memorize if the reading of births stopped before the end
+  // of the genealogy because the following births are beyond the
+  // loaded range of epochs
+  bool isStopped;
 
-  }
+} HistReader;
 
-  GAHistoryFree(&((*that)->history));
+// Header of the binary history files (.gah)
+// It is followed by the index of the first birth of each epoch
+// (nbEpoch + 1 uint64_t) and the epoch, id, father and mother columns
+// (nbBirth uint32_t each), the births being sorted by epoch
+typedef struct GahHeader {
 
-  free(*that);
+  // Magic number, GAH_MAGIC
+  char magic[4];
 
-}
+  // Version of the format, GAH_VERSION
+  uint32_t version;
 
-// Process the prior arguments from the command line
-// Return true if the arguments were correct, else false
-bool GAViewerProcessPriorCmdLineArguments(
-     GAViewer* const that,
-           const int argc,
-  const char** const argv) {
+  // Nb of births
+  uint64_t nbBirth;
 
-#if BUILDMODE == 0
-  if (that == NULL) {
+  // Nb of epochs
+  uint64_t nbEpoch;
 
-    GAViewerErr->_type = PBErrTypeNullPointer;
-    sprintf(
-      GAViewerErr->_msg,
-      "'that' is null");
-    PBErrCatch(GAViewerErr);
+  // Max id of births
+  uint64_t maxId;
 
-  }
+  // Size in bytes of the converted part of the source history, which
+  // ends with the last converted birth
+  uint64_t srcOffset;
 
-#endif
+  // Hash of the converted part of the source history
+  uint64_t srcHash;
 
-  // Loop on arguments
-  for (
-    int iArg = 1;
-    iArg < argc;
-    ++iArg) {
+  // Reserved for future use, padding the header to 64 bytes
+  uint64_t reserved;
 
-    int retStrCmp =
-      strcmp(
-        argv[iArg],
-        "-help");
-    if (retStrCmp == 0) {
+} GahHeader;
 
-      printf("gaviewer\n");
-      printf("[-help] : print the help message\n");
-      printf("[-hist] : path to the history file generated by " \
-        "GenAlg.GASaveHistory\n");
-      printf(
-        "[-toImg <path/to/img.tga>] : convert the history to an image " \
-        "and save it to the specified path\n");
-      printf(
-        "[-size <width,height>] : size in pixel of the generated image " \
-        "(square), default is 800px\n");
-      printf("[-from <epoch>] : first displayed epoch\n");
-      printf("[-to <epoch>] : last displayed epoch\n");
-      printf("\n");
+// Header of the layout cache files (.gal), saved beside the history
+// file. It is followed by the checkpoints (nbCheckpoint GalCheckpoint),
+// the index of the first node of each cached epoch relative to the
+// first cached node (nbEpoch + 1 uint64_t), and the id, father,
+// mother, rank and father index columns of the cached nodes (nbNode
+// uint32_t each)
+typedef struct GalHeader {
 
-    }
+  // Magic number, GAL_MAGIC
+  char magic[4];
 
-    // If the argument is -hist
-    retStrCmp =
-      strcmp(
-        argv[iArg],
-        "-hist");
-    if (
-      retStrCmp == 0 &&
-      iArg < argc - 1) {
+  // Version of the format, GAL_VERSION
+  uint32_t version;
 
-      // Try to open the file to check the path
-      FILE* stream =
-        fopen(
-          argv[iArg + 1],
-          "r");
+  // First cached epoch, which is the first ranked epoch of the layout
+  uint64_t fromEpoch;
 
-      // If the path is correct
-      if (stream != NULL) {
+  // Nb of cached epochs and nodes
+  uint64_t nbEpoch;
+  uint64_t nbNode;
 
-        // Update the path to history file
-        that->pathHistory = strdup(argv[iArg + 1]);
+  // Nb of checkpoints
+  uint64_t nbCheckpoint;
 
-        // Make sure the history is empty
-        GAHistoryFlush(&(that->history));
+  // Reserved for future use, padding the header to 64 bytes
+  uint64_t reserved[3];
 
-        // Load the history file
-        bool retLoad =
-          GAHistoryLoad(
-            &(that->history),
-            stream);
+} GalHeader;
 
-        // Close the stream
-        fclose(stream);
+// Checkpoint of the layout cache: the layout of the cached epochs
+// before 'epoch' is valid as long as the first 'srcSize' bytes of the
+// history have the hash 'srcHash'
+typedef struct GalCheckpoint {
 
-        // If we failed to load the history
-        if (retLoad == false) {
+  // Epoch up to which (excluded) the layout is valid
+  uint64_t epoch;
 
-          fprintf(
-            stderr,
-            "Couldn't load the history [%s]\n",
-            that->pathHistory);
-          return false;
+  // Size and hash of the part of the history the layout comes from
+  uint64_t srcSize;
+  uint64_t srcHash;
 
-        // Else, we could load the history
-        } else {
+  // Offset in the history of the first birth of 'epoch', where the
+  // following births are read from, 0 if unknown. If the checkpoint
+  // covers the whole genealogy, offset of the end of its last birth
+  uint64_t srcOffset;
 
-          // Convert the history into Nodes
-          GAViewerHistoryToNodes(that);
+  // Flag to memorize if the checkpoint covers the whole genealogy
+  uint64_t isComplete;
 
-          printf(
-            "Loaded the history [%s]\n",
-            that->pathHistory);
+} GalCheckpoint;
 
-        }
+// Header of the out-of-core layout files (.gao), written in the
+// directory of the out-of-core mode. It is followed, for each epoch
+// from 'fromEpoch', by its nb of nodes (uint32_t) and its nodes in
+// rank order (GaoNode)
+typedef struct GaoHeader {
 
-      // Else the path is incorrect
-      } else {
+  // Magic number, GAO_MAGIC
+  char magic[4];
 
-        fprintf(
-          stderr,
-          "The path [%s] is incorrect\n",
-          argv[iArg + 1]);
-        return false;
+  // Version of the format, GAO_VERSION
+  uint32_t version;
 
-      }
+  // First epoch, which is the first ranked epoch of the layout
+  uint64_t fromEpoch;
 
-    }
+  // Nb of epochs and nodes
+  uint64_t nbEpoch;
+  uint64_t nbNode;
 
-    // If the argument is -size
-    retStrCmp =
-      strcmp(
-        argv[iArg],
-        "-size");
-    if (
-      retStrCmp == 0 &&
-      iArg < argc - 1) {
+} GaoHeader;
 
-      // Decode the size
-      int size[2] = {0, 0};
-      char* posComma =
-        strchr(
-          argv[iArg + 1],
-          ',');
-      if (posComma != NULL) {
+// Node of the out-of-core layout files
+typedef struct GaoNode {
 
-        *posComma = '\0';
-        size[0] = atoi(argv[iArg + 1]);
-        *posComma = ',';
-        size[1] = atoi(posComma + 1);
+  // Id
+  uint32_t id;
 
-        // If the size is valid
-        if (size[0] > 0 && size[1] > 0) {
+  // Rank of the father in the previous epoch, GAO_NOFATHER if it's not
+  // in the previous epoch, with the flag GAO_SURVIVE if the node has
+  // the id of its father
+  uint32_t father;
 
-          // Set the size
-          VecSet(
-            &(that->dimHistoryImg),
-            0,
-            size[0]);
-          VecSet(
-            &(that->dimHistoryImg),
-            1,
-            size[1]);
+} GaoNode;
 
-        // Else, the size is not valid
-        } else {
+// Sort key of a node used by the comparison sort of the nodes
+typedef struct RankKey {
 
-          fprintf(
-            stderr,
-            "The size [%s] is incorrect\n",
-            argv[iArg + 1]);
-          return false;
+  // Rank of the father in the high bits and id in the low bits
+  uint64_t key;
 
-        }
+  // Index of the node
+  uint32_t iNode;
 
-      } else {
+} RankKey;
 
-          fprintf(
-            stderr,
-            "The size [%s] is incorrect\n",
-            argv[iArg + 1]);
-          return false;
+// Runs of births sorted by epoch written in temporary files by the
+// out-of-core mode, each run holding the births of a part of the
+// history
+typedef struct OocRuns {
 
-      }
+  // Directory of the run files
+  char* dir;
 
-    }
+  // Path of the layout file of the ranked epochs
+  char* pathLayout;
 
-    // If the argument is -from
-    retStrCmp =
-      strcmp(
-        argv[iArg],
-        "-from");
-    if (
-      retStrCmp == 0 &&
-      iArg < argc - 1) {
+  // Births waiting to be written in the next run, their nb, and the
+  // keys used to sort them by epoch
+  NodeBirth* births;
+  uint64_t nbBirth;
+  RankKey* keys;
 
-      // Decode the epoch
-      that->fromEpoch = atoi(argv[iArg + 1]);
+  // Nb of runs, and first and last epoch of the births of each run
+  int nbRun;
+  uint32_t* fromEpochs;
+  uint32_t* toEpochs;
 
-    }
+} OocRuns;
 
-    // If the argument is -to
-    retStrCmp =
-      strcmp(
-        argv[iArg],
-        "-to");
-    if (
-      retStrCmp == 0 &&
-      iArg < argc - 1) {
+// Layout of epochs loaded from the layout cache, applied to the nodes
+// once their columns are built
+typedef struct LayoutCache {
 
-      // Decode the epoch
-      that->toEpoch = atoi(argv[iArg + 1]);
+  // First epoch of the layout, and nb of loaded epochs
+  unsigned long fromEpoch;
+  unsigned long nbEpoch;
 
-    }
+  // Index of the first node of each loaded epoch relative to the first
+  // loaded node (nbEpoch + 1 values)
+  uint64_t* first;
 
-  }
+  // Rank of the loaded nodes and index of their father in the
+  // previous epoch
+  uint32_t* rank;
+  uint32_t* fatherIdx;
 
-  // If the user hasn't specified a last epoch
-  if (that->toEpoch == 0) {
+  // Checkpoints still valid, reused when the layout cache is saved
+  // again
+  GalCheckpoint* checkpoints;
+  unsigned long nbCheckpoint;
 
-    // Set it to the last epoch
-    that->toEpoch = that->nbEpoch - 1;
+} LayoutCache;
 
-  }
+// Index of the edges between the nodes of consecutive epochs, in
+// compressed sparse row format. The nodes are referred to by their
+// index minus the index of the first node of the first epoch of the
+// index. The parents of the node n, as indices in the previous epoch,
+// are parents[parentFirst[n]] to parents[parentFirst[n + 1] - 1], and
+// its children, as indices in the next epoch, are
+// children[childFirst[n]] to children[childFirst[n + 1] - 1]
+typedef struct EdgeIndex {
 
-  // Ensure the last displayed epoch is not greater than the
-  // last epoch
-  that->toEpoch =
-    MIN(
-      that->toEpoch,
-      that->nbEpoch - 1);
+  // First and last epochs of the index
+  unsigned long fromEpoch;
+  unsigned long toEpoch;
 
-  // Return the successfull code
-  return true;
+  // Index of the first node of the first epoch, and nb of nodes
+  uint64_t firstNode;
+  uint64_t nbNode;
 
-}
+  // Parents of the nodes (nbNode + 1 offsets)
+  uint64_t* parentFirst;
+  uint32_t* parents;
 
-// Process the posterior arguments from the command line
-// Return true if the arguments were correct, else false
-bool GAViewerProcessPosteriorCmdLineArguments(
-     GAViewer* const that,
-           const int argc,
-  const char** const argv) {
+  // Children of the nodes (nbNode + 1 offsets)
+  uint64_t* childFirst;
+  uint32_t* children;
 
-#if BUILDMODE == 0
-  if (that == NULL) {
+} EdgeIndex;
 
-    GAViewerErr->_type = PBErrTypeNullPointer;
-    sprintf(
-      GAViewerErr->_msg,
-      "'that' is null");
-    PBErrCatch(GAViewerErr);
+// Renderers used to create the image of the history
+typedef enum GAViewerRenderer {
 
-  }
+  // Draw the history with GenBrush objects
+  GAViewerRendererGenBrush,
 
-#endif
+  // Draw the history directly into a flat pixel buffer
+  GAViewerRendererDirect,
 
-  // Loop on arguments
-  for (
-    int iArg = 1;
-    iArg < argc;
-    ++iArg) {
+  // Draw the history directly into horizontal strips of pixels streamed
+  // to the file one after the other
+  GAViewerRendererStrips
 
-    int retStrCmp =
-      strcmp(
+} GAViewerRenderer;
+
+// Flat image used by the direct renderer, holding the pixels of a
+// window of a possibly larger image
+typedef struct Raster {
+
+  // Dimensions in pixels of the window
+  int width;
+  int height;
+
+  // Pixels of the window, row by row from the bottom of the image,
+  // packed as 0xAARRGGBB which is the byte order of 32 bits TGA files
+  // on little endian hosts
+  uint32_t* pixels;
+
+  // Dimensions in pixels of the whole image, used to lay out the
+  // history
+  int widthImg;
+  int heightImg;
+
+  // Position in the whole image of the bottom left pixel of the window
+  int originX;
+  int originY;
+
+  // First and last columns and rows, in the whole image, the drawing
+  // is clipped to
+  int xMin;
+  int xMax;
+  int yMin;
+  int yMax;
+
+} Raster;
+
+// Formats of the image files
+typedef enum ImgFormat {
+
+  // TGA, 32 bits run length encoded
+  ImgFormatTga,
+
+  // PNG, 24 bits
+  ImgFormatPng
+
+} ImgFormat;
+
+// Strip of consecutive rows encoded by an ImgWriter
+typedef struct ImgStrip {
+
+  // Offset and size in bytes of the raw rows of the strip in the raw
+  // buffer of the ImgWriter
+  size_t offsetRaw;
+  size_t sizeRaw;
+
+  // Encoded rows, their size in bytes, and the size of the memory
+  // allocated for them
+  unsigned char* data;
+  size_t size;
+  size_t sizeAlloc;
+
+  // Adler32 checksum of the raw rows (PNG only)
+  uLong adler;
+
+  // Flag to memorize if it's the last strip of the image
+  bool isLast;
+
+  // Flag to memorize if the encoding failed
+  bool isFailed;
+
+} ImgStrip;
+
+// Writer of image files receiving the rows of the image from the top
+// and writing them as soon as a batch of strips of rows is complete,
+// the strips of a batch being encoded in parallel
+typedef struct ImgWriter {
+
+  // Stream of the file
+  FILE* stream;
+
+  // Format of the file
+  ImgFormat format;
+
+  // Dimensions of the image in pixels
+  int width;
+  int height;
+
+  // Nb of threads encoding the strips
+  int nbThread;
+
+  // Nb of rows received
+  int nbRow;
+
+  // Size in bytes of a raw row: the packed pixels for TGA, the filter
+  // type followed by the RGB bytes for PNG
+  size_t sizeRow;
+
+  // Nb of rows per strip and nb of strips per batch
+  int nbRowStrip;
+  int nbStripBatch;
+
+  // Raw rows of the current batch, preceded by up to
+  // IMGWRITER_SIZEDICT bytes of the previous batch used as the
+  // dictionary of its first strip (PNG only)
+  unsigned char* raw;
+
+  // Nb of bytes of the previous batch kept in the raw buffer
+  size_t sizeHistory;
+
+  // Nb of rows waiting in the current batch
+  int nbRowPending;
+
+  // Strips of the current batch
+  ImgStrip* strips;
+
+  // Adler32 checksum of all the raw rows (PNG only)
+  uLong adler;
+
+  // Flag to memorize if an error occured
+  bool isFailed;
+
+} ImgWriter;
+
+// Writer of SVG files buffering the text of the elements and writing it
+// each time the buffer is full
+typedef struct SvgWriter {
+
+  // Stream of the file
+  FILE* stream;
+
+  // Buffer of the text waiting to be written, and its nb of bytes
+  char* buffer;
+  size_t size;
+
+  // Flag to memorize if an error occured
+  bool isFailed;
+
+} SvgWriter;
+
+// Set of kernels drawing the primitives of the direct renderer with a
+// given instruction set
+typedef struct RasterKernels {
+
+  // Name of the instruction set
+  const char* name;
+
+  // Kernel drawing a filled disc, cf RasterDrawDisc
+  void (*drawDisc)(
+    Raster* const,
+    const float,
+    const float,
+    const float,
+    const uint32_t);
+
+  // Kernel drawing a cubic Bezier curve, cf RasterDrawCurve
+  void (*drawCurve)(
+    Raster* const,
+    const float* const,
+    const uint32_t);
+
+  // Kernel adding the bytes of a row of pixels to sums, cf
+  // RasterDownscale
+  void (*accumulateRow)(
+    uint32_t* const,
+    const uint32_t* const,
+    const int);
+
+} RasterKernels;
+
+// Kernels used by RasterDrawDisc and RasterDrawCurve, selected when the
+// first Raster is created if not selected before
+static const RasterKernels* rasterKernels = NULL;
+
+// Render requested by a line of the jobs file
+typedef struct BatchJob {
+
+  // First and last displayed epochs, the last one being 0 for the last
+  // epoch of the history
+  unsigned long fromEpoch;
+  unsigned long toEpoch;
+
+  // Dimensions of the image in pixels
+  int width;
+  int height;
+
+  // Path of the image, and its format
+  char* path;
+  ImgFormat format;
+
+} BatchJob;
+
+typedef struct {
+
+  // Path to the history file
+  char* pathHistory;
+
+  // Path to the history image file, and its format
+  char* pathHistoryImg;
+  ImgFormat formatHistoryImg;
+
+  // Path to the binary history file the history is converted to
+  char* pathHistoryBin;
+
+  // Dimensions in pixels of the output image for history
+  int dimHistoryImg[2];
+
+  // Renderer used to create the image of the history
+  GAViewerRenderer renderer;
+
+  // Nb of threads drawing the image with the direct renderer
+  int nbThread;
+
+  // Flag to memorize if the epochs with more nodes than rows of pixels
+  // are aggregated by the direct renderer
+  bool isLod;
+
+  // Nodes loaded from the history
+  NodeStore nodes;
+
+  // Nb of epoch in the history
+  unsigned long nbEpoch;
+
+  // Max id of nodes in the history
+  unsigned long maxId;
+
+  // Nb of nodes in the history
+  unsigned long nbNode;
+
+  // Offset in the history file just after the last loaded birth
+  unsigned long offsetLastBirth;
+
+  // Range of epochs converted into nodes when loading the history
+  unsigned long loadFromEpoch;
+  unsigned long loadToEpoch;
+
+  // Index of the epochs in the history file
+  EpochIndex epochIndex;
+
+  // Flag to memorize if only the summary of the history is requested
+  bool isInfo;
+
+  // Flag to memorize if the image pyramid is requested, in which case
+  // the whole history is loaded and displayed, and range of epochs
+  // whose tiles are generated
+  bool isTiles;
+  unsigned long tilesFromEpoch;
+  unsigned long tilesToEpoch;
+
+  // Flag to memorize if the history is followed, the interval in
+  // seconds between two updates of the image, and the last displayed
+  // epoch specified by the user (0 if none)
+  bool isFollow;
+  double followInterval;
+  unsigned long followToEpoch;
+
+  // Renders requested with -jobs, and their nb
+  BatchJob* jobs;
+  int nbJob;
+
+  // Flag to memorize if a lineage is traced, the id and epoch of the
+  // node whose lineage is traced, and the flag to memorize if its
+  // descendants are traced instead of its ancestors
+  bool isTrace;
+  unsigned long traceId;
+  unsigned long traceEpoch;
+  bool isTraceDescendants;
+
+  // Bits of the traced nodes from the node 'traceFirstNode', the other
+  // nodes not being drawn, NULL if no lineage is traced
+  uint64_t* traceBits;
+  uint64_t traceFirstNode;
+  uint64_t traceNbNode;
+
+  // Flag to memorize if the history is displayed in the interactive
+  // window
+  bool isGui;
+
+  // Flag to memorize if the direct renderer draws only the last epoch
+  // of the columns of pixels shared by several epochs, so the cost of
+  // drawing doesn't depend on the nb of epochs
+  bool isOneEpochPerColumn;
+
+  // Directory of the temporary files of the out-of-core mode, NULL if
+  // the history is loaded in memory, and runs of the births read from
+  // the history in this mode
+  char* pathOoc;
+  OocRuns* oocRuns;
+
+  // First displayed epoch
+  unsigned long fromEpoch;
+
+  // Last displayed epoch
+  unsigned long toEpoch;
+
+} GAViewer;
+
+#if BUILDWITHGRAPHICLIB
+// Interactive window displaying the history of a GAViewer, drawn by the
+// direct renderer as the window of a virtual image whose size is the
+// one of the window multiplied by the zoom
+typedef struct GAViewerWindow {
+
+  // Displayed viewer
+  GAViewer* viewer;
+
+  // Widgets of the window
+  GtkWidget* window;
+  GtkWidget* area;
+  GtkWidget* label;
+
+  // Zoom along x and y, 1 when the whole history fits in the window
+  double zoomX;
+  double zoomY;
+
+  // Position in the virtual image of the bottom left pixel of the
+  // window
+  double originX;
+  double originY;
+
+  // Raster of the drawn pixels and surface displaying them, and flag
+  // to memorize if they must be drawn again
+  Raster raster;
+  cairo_surface_t* surface;
+  bool isDirty;
+
+  // Flag to memorize if the view is dragged, and last position of the
+  // pointer while it's dragged
+  bool isDragged;
+  double dragX;
+  double dragY;
+
+  // Flag to memorize if a node is hovered, and its epoch and index
+  bool isHovered;
+  unsigned long hoverEpoch;
+  uint64_t hoverNode;
+
+  // Time in seconds to draw the view the last time it changed
+  double timeDraw;
+
+} GAViewerWindow;
+#endif
+
+// Flag set by the signals stopping the follow mode
+static volatile sig_atomic_t followIsStopped = 0;
+
+// Counters of the hot paths reported by -stats
+typedef struct StatsCounters {
+
+  // Nb of searches of nodes by id, and nb of slots of the index of
+  // nodes compared by these searches
+  uint64_t nbSearch;
+  uint64_t nbCompare;
+
+  // Nb of shapoids and curves created for GenBrush, or of discs and
+  // curves drawn by the direct renderer
+  uint64_t nbShapoid;
+  uint64_t nbCurve;
+
+  // Nb of pixels written by the primitives of the direct renderer
+  uint64_t nbPixel;
+
+} StatsCounters;
+
+// Measures of a phase reported by -stats
+typedef struct StatsPhase {
+
+  // Name of the phase
+  const char* name;
+
+  // Wall and CPU times in seconds spent in the phase
+  double timeWall;
+  double timeCpu;
+
+  // Peak resident set size in KB of the process at the end of the
+  // phase
+  long peakRss;
+
+  // Counters of the hot paths during the phase
+  StatsCounters counters;
+
+} StatsPhase;
+
+// Formats of the report of -stats
+typedef enum StatsFormat {
+
+  // Table for humans
+  StatsFormatText,
+
+  // JSON object on one line
+  StatsFormatJson
+
+} StatsFormat;
+
+// Measures of the phases reported by -stats
+typedef struct Stats {
+
+  // Phases in the order they were started, a phase started several
+  // times accumulating its measures
+  StatsPhase phases[STATS_NBPHASEMAX];
+  int nbPhase;
+
+  // Index of the current phase, -1 if none
+  int iPhase;
+
+  // Wall and CPU times, and counters of all the threads, at the start
+  // of the current phase
+  double startWall;
+  double startCpu;
+  StatsCounters startCounters;
+
+  // Counters flushed by all the threads
+  StatsCounters counters;
+
+  // Format of the report
+  StatsFormat format;
+
+} Stats;
+
+// Flag to memorize if the statistics are measured, set by -stats
+static bool statsIsEnabled = false;
+
+// Counters of the current thread, added to the counters of all the
+// threads by StatsFlush
+static __thread StatsCounters statsCounters;
+
+// Measures of the phases
+static Stats stats;
+
+// Task run by ParallelFor on the items from 'from' to 'to' excluded of
+// the chunk 'iChunk', with the argument 'arg'
+typedef void (*ParallelTask)(
+  void* const arg,
+  const uint64_t from,
+  const uint64_t to,
+  const uint64_t iChunk);
+
+// Job shared by the threads of ParallelFor
+typedef struct ParallelJob {
+
+  // Task and its argument
+  ParallelTask task;
+  void* arg;
+
+  // Nb of items and of chunks they are split into
+  uint64_t nbItem;
+  uint64_t nbChunk;
+
+  // Index of the next chunk to run, shared by the threads
+  uint64_t nextChunk;
+
+} ParallelJob;
+
+// Tile of the image pyramid
+typedef struct TileRef {
+
+  // Level, column and row (from the top) of the tile
+  int level;
+  int col;
+  int row;
+
+} TileRef;
+
+// Argument of the tasks drawing the tiles of the image pyramid
+typedef struct TilesTask {
+
+  // Viewer whose history is drawn
+  const GAViewer* viewer;
+
+  // Path of the directory of the tiles
+  const char* path;
+
+  // Dimensions of the image at the most detailed level, and this level
+  int width;
+  int height;
+  int levelMax;
+
+  // Tiles to draw
+  TileRef* tiles;
+
+  // Nb of tiles which couldn't be saved, shared by the threads
+  uint64_t nbFail;
+
+} TilesTask;
+
+// Argument of the tasks running the jobs of a batch, one unit of jobs
+// with the same range of epochs per item
+typedef struct BatchTask {
+
+  // Viewer whose history is drawn
+  const GAViewer* viewer;
+
+  // Jobs, sorted by range of epochs then decreasing nb of pixels
+  const BatchJob* jobs;
+
+  // Index of the first job of each unit, followed by the index after
+  // the last job of the last unit
+  int* firstJob;
+
+  // Nb of threads drawing and saving the images of a unit
+  int nbThread;
+
+  // Nb of images which couldn't be saved, shared by the threads
+  uint64_t nbFail;
+
+} BatchTask;
+
+// Individual of a synthetic history generated by GAViewerGenHistory
+typedef struct GenIndiv {
+
+  // Id of the individual
+  unsigned long id;
+
+  // Fitness of the individual, random at its birth
+  int fitness;
+
+} GenIndiv;
+
+// Argument of the tasks building the node columns
+typedef struct BuildTask {
+
+  // Waiting births
+  const NodeBirth* births;
+
+  // Nb of epochs
+  unsigned long nbEpoch;
+
+  // Nb of births of each epoch in each chunk of births, then position
+  // of the first birth of each epoch of each chunk in the columns
+  uint64_t* counts;
+
+  // Columns where the births are scattered
+  uint32_t* id;
+  uint32_t* father;
+  uint32_t* mother;
+
+} BuildTask;
+
+// Buffers used by RankSort
+typedef struct RankSortBuffer {
+
+  // Sort keys of the nodes
+  uint32_t* keys;
+
+  // Order of the nodes by id
+  uint32_t* tmp;
+
+  // Counters of the counting sorts
+  uint32_t* counts;
+
+} RankSortBuffer;
+
+// Argument of the tasks ranking the nodes
+typedef struct RankTask {
+
+  // Viewer whose nodes are ranked
+  GAViewer* viewer;
+
+  // First ranked epoch, whose nodes have no father
+  unsigned long firstEpoch;
+
+  // First epoch ranked by the task, and first node of this epoch
+  unsigned long fromEpoch;
+  uint64_t fromNode;
+
+} RankTask;
+
+// Bundle of the edges between a row of pixels of an epoch and a row of
+// pixels of the previous epoch, when drawing the epoch in LOD mode
+typedef struct LodBundle {
+
+  // Nb of edges in the bundle
+  uint32_t count;
+
+  // Row of the children and of the fathers
+  uint32_t rowChild;
+  uint32_t rowFather;
+
+  // Flag to memorize if the edges are from a survivor to itself
+  uint32_t isSurvive;
+
+  // Position of the fathers along y
+  float yFather;
+
+} LodBundle;
+
+// Buffers used to aggregate the nodes and edges of an epoch in LOD mode
+typedef struct LodBuffer {
+
+  // Nb of edges from the current row of the epoch to each row of the
+  // previous epoch, for births and survivors, and the position of the
+  // fathers along y
+  uint32_t* counts;
+  float* yFathers;
+
+  // Indices in 'counts' of the non zero ones
+  uint32_t* touched;
+  uint32_t nbTouched;
+
+  // Bundles of the epoch
+  LodBundle* bundles;
+  uint64_t nbBundle;
+  uint64_t nbBundleAlloc;
+
+} LodBuffer;
+
+// Queue of the tiles of the image to be drawn by one render thread,
+// the tiles from 'head' to 'tail' excluded are left, the thread takes
+// them from the head and the other threads steal them from the tail
+typedef struct RenderQueue {
+
+  // Mutex protecting the queue
+  pthread_mutex_t mutex;
+
+  // Range of the tiles left in the queue
+  int head;
+  int tail;
+
+} RenderQueue;
+
+// Job shared by the render threads
+typedef struct RenderJob {
+
+  // Viewer whose history is drawn
+  const GAViewer* viewer;
+
+  // Raster where the history is drawn
+  Raster* raster;
+
+  // Columns of the tiles, the tile i covers from tileX[i] to
+  // tileX[i + 1] excluded
+  int* tileX;
+
+  // Queues of each thread
+  RenderQueue* queues;
+  int nbThread;
+
+} RenderJob;
+
+// Argument of a render thread
+typedef struct RenderWorker {
+
+  // Shared job
+  RenderJob* job;
+
+  // Index of the thread
+  int iThread;
+
+} RenderWorker;
+
+// Function to create a new GAViewer,
+// Return a pointer to the new GAViewer
+GAViewer* GAViewerCreate(void);
+
+// Function to free the memory used by the GAViewer 'that'
+void GAViewerFree(GAViewer** const that);
+
+// Process the prior arguments from the command line
+// Return true if the arguments were correct, else false
+bool GAViewerProcessPriorCmdLineArguments(
+     GAViewer* const that,
+           const int argc,
+  const char** const argv);
+
+// Process the posterior arguments from the command line
+// Return true if the arguments were correct, else false
+bool GAViewerProcessPosteriorCmdLineArguments(
+     GAViewer* const that,
+           const int argc,
+  const char** const argv);
+
+// Create the image from the history
+// Return true if successfull, else false
+bool GAViewerHistoryToImg(GAViewer* const that);
+
+// Create the image from the history with GenBrush objects
+// Return true if successfull, else false
+bool GAViewerHistoryToImgGenBrush(GAViewer* const that);
+
+// Create the image from the history by drawing directly into a Raster
+// Return true if successfull, else false
+bool GAViewerHistoryToImgDirect(GAViewer* const that);
+
+// Create the image from the history by drawing it directly into
+// horizontal strips of pixels, from the top of the image, each strip
+// being added to the image file before the next one is drawn
+// Return true if successfull, else false
+bool GAViewerHistoryToImgStrips(GAViewer* const that);
+
+// Create the image from the layout file of the out-of-core mode with
+// the direct renderer, reading one epoch at a time
+// Return true if successfull, else false
+bool GAViewerHistoryToImgOutOfCore(GAViewer* const that);
+
+// Save the history of the GAViewer 'that' as a SVG image at 'path',
+// with the same layout as the direct renderer, the elements being
+// streamed to the file while the epochs are walked
+// Return true if successfull, else false
+bool GAViewerHistoryToSvg(
+  const GAViewer* const that,
+      const char* const path);
+
+// Add to the SvgWriter 'writer' the path element holding the edges
+// of the ink 'isSurvive' (edges of survivors if true, else of births)
+// between the nodes of the epoch 'iEpoch' and their father, for the
+// image of 'height' pixels with 'stepXEpoch' pixels between two
+// epochs
+void GAViewerSvgAddEdges(
+  const GAViewer* const that,
+       SvgWriter* const writer,
+    const unsigned long iEpoch,
+             const bool isSurvive,
+            const float stepXEpoch,
+              const int height);
+
+// Save at 'path' the statistics of each displayed epoch of the history
+// of the GAViewer 'that' as CSV: its nb of nodes, births and survivors,
+// the nb of distinct fathers of its births, the distribution of the nb
+// of births per node of the previous epoch, and the nb of lineages of
+// the first ranked epoch it still holds
+// Return true if successfull, else false
+bool GAViewerHistoryToStatsCsv(
+  const GAViewer* const that,
+      const char* const path);
+
+// Follow the history of the GAViewer 'that': draw its image, then
+// watch its file and, each time it has grown and at most every
+// 'that->followInterval' seconds, load the appended births, rank the
+// new epochs and redraw the columns from the first changed epoch,
+// until SIGINT or SIGTERM
+// Return true if successfull, else false
+bool GAViewerFollow(GAViewer* const that);
+
+// Display the history of the GAViewer 'that' in an interactive window,
+// where the view is dragged with the left button, zoomed with the
+// wheel (only along x with Shift, only along y with Ctrl), and the
+// hovered node is described below it
+// Return true if successfull, else false
+bool GAViewerShowWindow(GAViewer* const that);
+
+// Pick the node of the GAViewer 'that' laid out in an image of
+// 'widthImg' x 'heightImg' pixels at the position 'x', 'y' of this
+// image. The epochs are evenly spaced columns and the nodes of an
+// epoch evenly spaced rows, so the layout is its own spatial index:
+// the epoch and the rank of the nearest node are calculated from the
+// position. The node is picked if it's drawn and its disc is within
+// 'distMax' pixels of the position, in which case its epoch and index
+// are returned in 'iEpoch' and 'iNode'
+// Return true if a node is picked, else false
+bool GAViewerPickNode(
+  const GAViewer* const that,
+              const int widthImg,
+              const int heightImg,
+            const float x,
+            const float y,
+            const float distMax,
+    unsigned long* const iEpoch,
+         uint64_t* const iNode);
+
+#if BUILDWITHGRAPHICLIB
+// Callback drawing the view of the GAViewerWindow 'data' in the
+// drawing area 'widget' with the cairo context 'cr'
+gboolean GAViewerWindowOnDraw(
+   GtkWidget* widget,
+     cairo_t* cr,
+    gpointer data);
+
+// Callback zooming the view of the GAViewerWindow 'data' around the
+// pointer
+gboolean GAViewerWindowOnScroll(
+       GtkWidget* widget,
+  GdkEventScroll* event,
+         gpointer data);
+
+// Callback starting and ending the drag of the view of the
+// GAViewerWindow 'data'
+gboolean GAViewerWindowOnButton(
+       GtkWidget* widget,
+  GdkEventButton* event,
+         gpointer data);
+
+// Callback dragging the view of the GAViewerWindow 'data', or picking
+// the node under the pointer
+gboolean GAViewerWindowOnMotion(
+       GtkWidget* widget,
+  GdkEventMotion* event,
+         gpointer data);
+
+// Callback of the keys of the GAViewerWindow 'data': Home or 0 to
+// reset the view, + and - to zoom around the center, q or Escape to
+// quit
+gboolean GAViewerWindowOnKey(
+    GtkWidget* widget,
+  GdkEventKey* event,
+      gpointer data);
+
+// Multiply the zoom of the GAViewerWindow 'that' by 'factorX' and
+// 'factorY', keeping the point of the virtual image under the position
+// 'x', 'y' of the window at the same place
+void GAViewerWindowZoom(
+  GAViewerWindow* const that,
+     const double factorX,
+     const double factorY,
+           const double x,
+           const double y);
+
+// Clamp the zoom and the position of the view of the GAViewerWindow
+// 'that' to the virtual image, and request to draw the view again
+void GAViewerWindowUpdateView(GAViewerWindow* const that);
+
+// Update the text describing the hovered node and the view below the
+// view of the GAViewerWindow 'that'
+void GAViewerWindowUpdateLabel(GAViewerWindow* const that);
+#endif
+
+// Load the births appended to the history file of the followed
+// GAViewer 'that' and redraw the changed epochs in the Raster 'raster'
+// and save it. If the appended births are incomplete, they are
+// discarded until the next change of the history
+// Return false if the image couldn't be saved, else true
+bool GAViewerFollowUpdate(
+  GAViewer* const that,
+    Raster* const raster);
+
+// Set the last displayed epoch of the followed GAViewer 'that': the one
+// specified by the user if any, else leave room for as many epochs as
+// there are displayed ones when the last epoch reaches it
+void GAViewerFollowLayout(GAViewer* const that);
+
+// Redraw in the Raster 'raster' the columns of the followed GAViewer
+// 'that' from the epoch 'fromEpoch', and save it
+// Return true if successfull, else false
+bool GAViewerFollowDraw(
+    GAViewer* const that,
+      Raster* const raster,
+  unsigned long fromEpoch);
+
+// Handler of the signals stopping the follow mode
+void GAViewerFollowStop(int sig);
+
+// Create the image pyramid of the history in the directory 'path': a
+// Deep Zoom manifest and the tiles of each level, only the tiles
+// covering the epochs 'that->tilesFromEpoch' to 'that->tilesToEpoch'
+// being drawn
+// Return true if successfull, else false
+bool GAViewerHistoryToTiles(
+  GAViewer* const that,
+  const char* const path);
+
+// Get in 'rankFrom' and 'rankTo' the range of ranks of the nodes of
+// the epoch 'iEpoch' whose disc or edge to their father may be drawn in
+// the clipped rows of the Raster 'raster', 'margin' being the max
+// distance along y between a node and the pixels of its disc
+// Return false if there is no such node, else true
+bool GAViewerGetRangeRankClip(
+  const GAViewer* const that,
+   const Raster* const raster,
+   const unsigned long iEpoch,
+           const float margin,
+        uint32_t* const rankFrom,
+        uint32_t* const rankTo);
+
+// Get the dimension of the level 'level' of the image pyramid from the
+// dimension 'dim' of its most detailed level 'levelMax'
+int GAViewerGetDimTiles(
+  const int dim,
+  const int level,
+  const int levelMax);
+
+// Task drawing and saving tiles of the image pyramid, 'arg' is a
+// TilesTask
+void GAViewerTaskDrawTiles(
+      void* const arg,
+   const uint64_t from,
+   const uint64_t to,
+   const uint64_t iChunk);
+
+// Create the directory at 'path' if it doesn't exist yet
+// Return true if the directory exists, else false
+bool GAViewerMakeDir(const char* const path);
+
+// Load the jobs of the batch file at 'path' into the GAViewer 'that',
+// one job per line: '<from> <to> <width>,<height> <path/to/img>', the
+// empty lines and the ones starting with '#' being ignored
+// Return true if successfull, else false
+bool GAViewerLoadJobs(
+    GAViewer* const that,
+  const char* const path);
+
+// Free the jobs of the GAViewer 'that'
+void GAViewerFreeJobs(GAViewer* const that);
+
+// Run the jobs of the GAViewer 'that': the nodes are ranked once per
+// first epoch, then the units of jobs with the same range of epochs are
+// run in parallel. A unit draws its largest image, and each image whose
+// dimensions don't divide the ones of an image already drawn, and the
+// other images are downscaled from the smallest image drawn whose
+// dimensions they divide
+// Return true if all the images were saved, else false
+bool GAViewerRunJobs(GAViewer* const that);
+
+// Comparison function of the BatchJob, for qsort, by increasing first
+// then last epoch, then decreasing nb of pixels
+int BatchJobCmp(
+  const void* a,
+  const void* b);
+
+// Task running units of jobs with the same range of epochs, 'arg' is a
+// BatchTask
+void GAViewerTaskRunJobs(
+      void* const arg,
+   const uint64_t from,
+   const uint64_t to,
+   const uint64_t iChunk);
+
+// Draw the part of the history inside the clipped columns and rows of
+// the Raster 'raster'
+void GAViewerDrawHistory(
+  const GAViewer* const that,
+         Raster* const raster);
+
+// Draw the nodes of rank 'rankFrom' to 'rankTo' of the epoch 'iEpoch'
+// in the Raster 'raster' in LOD mode: the nodes are aggregated per row
+// of pixels and the edges to their fathers are aggregated into bundles
+// per rows of pixels, drawn with an intensity increasing with their nb
+// of edges, using the buffers 'buffer'
+void GAViewerDrawEpochLod(
+  const GAViewer* const that,
+         Raster* const raster,
+   const unsigned long iEpoch,
+        const uint32_t rankFrom,
+        const uint32_t rankTo,
+      LodBuffer* const buffer);
+
+// Draw the bundles of the edges of the epoch 'iEpoch' of 'nbNode'
+// nodes aggregated in the LodBuffer 'buffer' in the Raster 'raster',
+// from the lightest to the darkest
+void GAViewerDrawLodBundles(
+  const GAViewer* const that,
+          Raster* const raster,
+    const unsigned long iEpoch,
+         const uint32_t nbNode,
+       LodBuffer* const buffer);
+
+// Draw the epoch 'iEpoch' of the out-of-core mode, whose 'nbNode'
+// nodes in rank order are 'nodes' and whose previous epoch has
+// 'nbNodePrev' nodes, in the Raster 'raster', in LOD mode with the
+// buffers 'lod' if it has more nodes than rows of pixels
+void GAViewerDrawEpochOutOfCore(
+  const GAViewer* const that,
+          Raster* const raster,
+    const unsigned long iEpoch,
+   const GaoNode* const nodes,
+         const uint32_t nbNode,
+         const uint32_t nbNodePrev,
+       LodBuffer* const lod);
+
+// Create a static LodBuffer for an image of 'height' pixels
+LodBuffer LodBufferCreateStatic(const int height);
+
+// Free the memory used by the LodBuffer 'that'
+void LodBufferFree(LodBuffer* const that);
+
+// Add the bundles of the edges of the row 'row' aggregated in the
+// LodBuffer 'that' to its bundles
+void LodBufferFlushRow(
+  LodBuffer* const that,
+    const uint32_t row);
+
+// Comparison function of the LodBundle, for qsort, by increasing nb of
+// edges then position
+int LodBundleCmp(
+  const void* a,
+  const void* b);
+
+// Draw the history in the Raster 'raster' with 'that->nbThread' threads,
+// each drawing tiles of columns balanced by their nb of nodes and edges
+void GAViewerDrawHistoryTiled(
+  const GAViewer* const that,
+         Raster* const raster);
+
+// Get the step along x between two epoch lines of the GAViewer 'that'
+// for the Raster 'raster'
+float GAViewerGetStepXEpoch(
+  const GAViewer* const that,
+   const Raster* const raster);
+
+// Return true if the epoch 'iEpoch' is not drawn by the GAViewer
+// 'that' because it shares its column of pixels with the next epoch
+// and only the last epoch of each column is drawn, 'stepXEpoch' being
+// the step along x between two epochs
+static inline bool GAViewerIsEpochCovered(
+  const GAViewer* const that,
+          const float stepXEpoch,
+  const unsigned long iEpoch);
+
+// Main function of the render threads, 'arg' is a RenderWorker
+void* GAViewerRenderWorker(void* arg);
+
+// Run the task 'task' with the argument 'arg' on 'nbItem' items split
+// into 'nbChunk' chunks of consecutive items, with 'nbThread' threads
+// taking the next chunk to run until all are done. The chunks are the
+// same whatever the nb of threads
+void ParallelFor(
+          const int nbThread,
+     const uint64_t nbItem,
+     const uint64_t nbChunk,
+  const ParallelTask task,
+         void* const arg);
+
+// Main function of the threads of ParallelFor, 'arg' is a ParallelJob
+void* ParallelWorker(void* arg);
+
+// Enable the statistics, reported in the format 'format'
+void StatsEnable(const StatsFormat format);
+
+// End the current phase of the statistics, if any, and start the phase
+// 'name'
+void StatsStartPhase(const char* const name);
+
+// Add the counters of the current thread to the counters of all the
+// threads, and reset them
+void StatsFlush(void);
+
+// End the current phase of the statistics and print the measures of
+// all the phases in the stream 'stream'
+void StatsPrint(FILE* const stream);
+
+// Get the CPU time in seconds used by the process
+double StatsGetCpuTime(void);
+
+// Task counting the births per epoch in a chunk of births, 'arg' is a
+// BuildTask
+void GAViewerTaskCountBirths(
+      void* const arg,
+  const uint64_t from,
+  const uint64_t to,
+  const uint64_t iChunk);
+
+// Task scattering a chunk of births to their epoch in the columns,
+// 'arg' is a BuildTask
+void GAViewerTaskScatterBirths(
+      void* const arg,
+  const uint64_t from,
+  const uint64_t to,
+  const uint64_t iChunk);
+
+// Task indexing the nodes of ranked epochs, 'arg' is a RankTask
+void GAViewerTaskIndexNodes(
+      void* const arg,
+  const uint64_t from,
+  const uint64_t to,
+  const uint64_t iChunk);
+
+// Task searching the fathers of ranked nodes, 'arg' is a RankTask
+void GAViewerTaskSearchFathers(
+      void* const arg,
+  const uint64_t from,
+  const uint64_t to,
+  const uint64_t iChunk);
+
+// Get the next tile to draw for the thread 'iThread' of the RenderJob
+// 'job' into 'iTile', from its own queue or else stolen from another
+// thread's queue
+// Return false if there is no more tile, else true
+bool RenderJobNextTile(
+  RenderJob* const job,
+    const int iThread,
+         int* const iTile);
+
+// Load the history file 'that->pathHistory', converting it first to
+// a binary history if requested, and rank its nodes in the range of
+// displayed epochs
+// Return true if successfull, else false
+bool GAViewerLoad(GAViewer* const that);
+
+// Load the history of the GAViewer 'that' in the out-of-core mode: the
+// births are written in runs sorted by epoch in the directory
+// 'that->pathOoc', then ranked epoch by epoch into a layout file
+// Return true if successfull, else false
+bool GAViewerLoadOutOfCore(GAViewer* const that);
+
+// Rank the births of the runs of the GAViewer 'that' epoch by epoch,
+// only two epochs being in memory at once, and write the nodes of the
+// ranked epochs in rank order in the layout file of the runs
+// Return true if successfull, else false
+bool GAViewerRankOutOfCore(GAViewer* const that);
+
+// Load the nodes from the history in the stream 'stream', and index
+// the epochs
+// Return true if successfull, else false
+bool GAViewerLoadHistory(
+  GAViewer* const that,
+     FILE* const stream);
+
+// Load the nodes from the history in the stream 'stream' from the
+// offset 'offset' of the first birth of an epoch until the end of the
+// range of loaded epochs
+// Return true if successfull, else false
+bool GAViewerLoadHistoryRange(
+      GAViewer* const that,
+         FILE* const stream,
+  const uint64_t offset);
+
+// Get the path of the file with extension 'ext' beside the history
+// file of the GAViewer 'that'
+// Return a newly allocated string
+char* GAViewerGetSidecarPath(
+  const GAViewer* const that,
+      const char* const ext);
+
+// Load the index of epochs and the summary of the history file from its
+// index file
+// Return true if the index file exists and is up to date, else false
+bool GAViewerLoadEpochIndex(GAViewer* const that);
+
+// Save the index of epochs and the summary of the history file into its
+// index file
+// Return true if successfull, else false
+bool GAViewerSaveEpochIndex(const GAViewer* const that);
+
+// Load from the layout cache of the history file of the GAViewer 'that'
+// the nodes of the loaded epochs covered by its last valid checkpoint,
+// and their layout into 'cache'. The history in 'stream' is used to
+// check the checkpoints. 'offsetResume' is set to the offset in the
+// history from where the births of the following loaded epochs must be
+// read, or 0 if there is none
+// Return true if the nodes could be loaded from the cache, else false
+bool GAViewerLoadLayout(
+     GAViewer* const that,
+        FILE* const stream,
+  LayoutCache* const cache,
+     uint64_t* const offsetResume);
+
+// Set the ranks of the nodes of the GAViewer 'that' to the layout
+// 'cache', for the epochs whose nodes are the cached ones, and index
+// them
+void GAViewerApplyLayout(
+           GAViewer* const that,
+  const LayoutCache* const cache);
+
+// Save the layout of the ranked epochs of the GAViewer 'that' into the
+// layout cache of its history file, with a checkpoint every
+// GAL_CHECKPOINT epochs, reusing the ones of 'cache' still valid if
+// the epoch index of the history is not available
+// Return true if successfull, else false
+bool GAViewerSaveLayout(
+           GAViewer* const that,
+  const LayoutCache* const cache);
+
+// Get the summary of the history file 'that->pathHistory' into
+// 'that->epochIndex', from its index file if it's up to date, else by
+// reading the history without converting it into nodes
+// Return true if successfull, else false
+bool GAViewerLoadInfo(GAViewer* const that);
+
+// Print the summary of the history of the GAViewer 'that' on the
+// stream 'stream'
+void GAViewerPrintInfo(
+  const GAViewer* const that,
+            FILE* const stream);
+
+// Add the node 'id' born at epoch 'epoch' from 'father' and 'mother'
+// Return false if the node exceeds the 32 bits capacity of the
+// NodeStore, else true
+bool GAViewerAddNode(
+  GAViewer* const that,
+    unsigned long epoch,
+    unsigned long father,
+    unsigned long mother,
+    unsigned long id);
+
+// Add the births waiting in the NodeStore of the GAViewer 'that' to
+// its columns, grouping them by epoch, and allocate the columns
+// calculated from them
+void GAViewerBuildNodes(GAViewer* const that);
+
+// Append the births waiting in the NodeStore of the GAViewer 'that' to
+// the end of its columns, if they are sorted by epoch from the last
+// epoch of the columns and fit in the allocated columns. The nodes of
+// the other epochs keep their position, rank and hash table
+// Return true if the births were appended, else false
+bool GAViewerAppendNodes(GAViewer* const that);
+
+// Free the nodes of the GAViewer 'that'
+void GAViewerFreeNodes(GAViewer* const that);
+
+// Load the births appended to the history in the stream 'stream'
+// since the last birth loaded by the GAViewer 'that'. If the end of the
+// last loaded birth is unknown, the nodes are loaded again from the
+// whole history
+// Return true if successfull, else false
+bool GAViewerLoadHistoryAppend(
+  GAViewer* const that,
+     FILE* const stream);
+
+// Read the header of the binary history file at 'path' into 'header'
+// Return true if it's a valid binary history file, else false
+bool GAViewerReadBinHeader(
+  const char* const path,
+   GahHeader* const header);
+
+// Load the nodes from the binary history file at 'path'
+// Return true if successfull, else false
+bool GAViewerLoadBin(
+    GAViewer* const that,
+  const char* const path);
+
+// Save the nodes of the GAViewer 'that' into the binary history file
+// at 'path'. 'stream' is the source history the nodes have been
+// loaded from
+// Return true if successfull, else false
+bool GAViewerSaveBin(
+     GAViewer* const that,
+  const char* const path,
+        FILE* const stream);
+
+// Convert the history file of the GAViewer 'that' into the binary
+// history file 'that->pathHistoryBin'. If the binary history file
+// has already been created from the same history, only the births
+// appended to the history since then are decoded
+// Return true if successfull, else false
+bool GAViewerConvertHistory(GAViewer* const that);
+
+// Get the hash of the first 'size' bytes of the stream 'stream'
+uint64_t GAViewerHashSource(
+          FILE* const stream,
+  const unsigned long size);
+
+// Get the hash of the bytes 'from' to 'to' (excluded) of the stream
+// 'stream', continuing the hash 'hash' of the bytes before 'from'
+uint64_t GAViewerHashSourceRange(
+          FILE* const stream,
+       const uint64_t hash,
+  const unsigned long from,
+  const unsigned long to);
+
+// Sort the nodes of each displayed epoch, and the one before, according
+// to the rank of their father and index them
+void GAViewerRankNodes(GAViewer* const that);
+
+// Comparison function of the RankKey, for qsort
+int GAViewerCmpKeys(
+  const void* a,
+  const void* b);
+
+// Create a static RankSortBuffer for epochs of up to 'nbNodeMax' nodes
+RankSortBuffer RankSortBufferCreateStatic(const uint64_t nbNodeMax);
+
+// Free the memory used by the RankSortBuffer 'that'
+void RankSortBufferFree(RankSortBuffer* const that);
+
+// Sort the 'nbNode' nodes of sort keys 'that->keys', which are in
+// [0, keyMax], and of ids 'ids' by increasing key, then id, then index,
+// and set 'order' to the index of the nodes in that order
+void RankSort(
+  RankSortBuffer* const that,
+        const uint32_t nbNode,
+        const uint32_t keyMax,
+  const uint32_t* const ids,
+        uint32_t* const order);
+
+// Run the benchmark of the sort of nodes with the comparison sort and
+// with RankSort for epochs of 10^3 up to 10^6 nodes
+void GAViewerBenchRank(void);
+
+// Get the max id from the history
+unsigned long GAViewerHistoryGetMaxId(GAViewer* const that);
+
+// Get the nb of epoch from the history
+unsigned long GAViewerHistoryGetNbEpoch(GAViewer* const that);
+
+// Search a node based on its id at a given epoch
+// Return the index of the node in its epoch, NODE_NONE if not found
+uint32_t GAViewerSearchNode(
+  const GAViewer* const that,
+          unsigned long epoch,
+          unsigned long id);
+
+// Search a node based on its id at a given epoch by scanning the whole
+// epoch, used as the reference for the indexed search
+// Return the index of the node in its epoch, NODE_NONE if not found
+uint32_t GAViewerSearchNodeLinear(
+  const GAViewer* const that,
+          unsigned long epoch,
+          unsigned long id);
+
+// Get the first slot probed for the id 'id' in a hash table of nodes
+// whose nb of slots is the power of 2 'mask' + 1. The slot is given by
+// the high bits of the multiplicative hash of the id, as its low bits
+// only depend on the low bits of the id
+static inline uint64_t NodeIndexGetSlot(
+  const uint32_t id,
+  const uint64_t mask);
+
+// Create the index of the nodes at the epoch 'epoch'
+void GAViewerIndexNodes(
+  GAViewer* const that,
+    unsigned long epoch);
+
+// Create in 'index' the index of the edges from the nodes of the epochs
+// 'fromEpoch' + 1 to 'toEpoch' to their father and mother in the
+// previous epoch, and the reverse edges. The nodes of these epochs
+// must be ranked, as their fathers are the ones found by the ranking
+void GAViewerBuildEdgeIndex(
+  const GAViewer* const that,
+    const unsigned long fromEpoch,
+    const unsigned long toEpoch,
+       EdgeIndex* const index);
+
+// Trace the ancestors, or the descendants, of the node
+// 'that->traceId' at the epoch 'that->traceEpoch' over the loaded
+// epochs, print them per epoch and keep the bits of the traced nodes
+// to draw only them
+// Return true if successfull, else false
+bool GAViewerTrace(GAViewer* const that);
+
+// Return true if the node 'iNode' is drawn, which is when no lineage is
+// traced or the node is in the traced lineage, else false
+static inline bool GAViewerIsTraced(
+  const GAViewer* const that,
+         const uint64_t iNode);
+
+// Run the benchmark of the search of nodes on a synthetic history
+// with 'nbNode' nodes per epoch
+void GAViewerBenchSearch(const unsigned long nbNode);
+
+// Generate a synthetic history in the GenAlg format and save it at
+// 'path': 'nbEpoch' epochs of 'nbPop' individuals, the 'eliteRatio'
+// best ones surviving to the next epoch and the other ones being
+// replaced by children of the elites, a child taking the id of an
+// individual dead at the previous epoch with the probability 'idReuse'
+// instead of a new id
+// Return true if successfull, else false
+bool GAViewerGenHistory(
+  const char* const path,
+  const unsigned long nbEpoch,
+  const unsigned long nbPop,
+          const float eliteRatio,
+          const float idReuse);
+
+// Comparison function of the GenIndiv, for qsort, by decreasing
+// fitness then increasing id
+int GenIndivCmp(
+  const void* a,
+  const void* b);
+
+// Run the benchmark of the phases of the conversion of a history into
+// an image (parse, node conversion, ranking, rendering with the direct
+// renderer and save) on synthetic histories of increasing size, with
+// 'nbThread' threads, and save the results as CSV at 'path'
+// Return true if successfull, else false
+bool GAViewerBenchPhases(
+  const char* const path,
+          const int nbThread);
+
+// Get the time in seconds of the monotonic clock
+double GAViewerGetTime(void);
+
+// Create a static empty NodeStore
+NodeStore NodeStoreCreateStatic(void);
+
+// Create a static empty EpochIndex
+EpochIndex EpochIndexCreateStatic(void);
+
+// Free the memory used by the EpochIndex 'that', which becomes empty
+void EpochIndexFree(EpochIndex* const that);
+
+// Add the birth of 'id' at offset 'offset' in the history file, for
+// the epoch 'epoch', to the EpochIndex 'that'
+void EpochIndexAddBirth(
+  EpochIndex* const that,
+    unsigned long epoch,
+   const uint64_t offset,
+    unsigned long id);
+
+// Create the runs of births of the out-of-core mode in the directory
+// 'dir', created if necessary
+// Return the new OocRuns, NULL if the directory couldn't be created
+OocRuns* OocRunsCreate(const char* const dir);
+
+// Free the memory used by the OocRuns 'that' and remove its files
+void OocRunsFree(OocRuns** const that);
+
+// Get the path of the run file 'iRun' of the OocRuns 'that'
+// Return a newly allocated string
+char* OocRunsGetPath(
+  const OocRuns* const that,
+             const int iRun);
+
+// Add the birth 'birth' to the OocRuns 'that', writing the buffered
+// births as a new run when the buffer is full
+// Return true if successfull, else false
+bool OocRunsAddBirth(
+          OocRuns* const that,
+  const NodeBirth* const birth);
+
+// Write the buffered births of the OocRuns 'that' as a new run, sorted
+// by epoch
+// Return true if successfull, else false
+bool OocRunsFlush(OocRuns* const that);
+
+// Create a static empty LayoutCache
+LayoutCache LayoutCacheCreateStatic(void);
+
+// Free the memory used by the LayoutCache 'that', which becomes empty
+void LayoutCacheFree(LayoutCache* const that);
+
+// Create a static empty EdgeIndex
+EdgeIndex EdgeIndexCreateStatic(void);
+
+// Free the memory used by the EdgeIndex 'that', which becomes empty
+void EdgeIndexFree(EdgeIndex* const that);
+
+// Free the memory used by the NodeStore 'that', which becomes empty
+void NodeStoreFree(NodeStore* const that);
+
+// Create a static Raster of 'width' x 'height' pixels
+Raster RasterCreateStatic(
+  const int width,
+  const int height);
+
+// Free the memory used by the Raster 'that'
+void RasterFree(Raster* const that);
+
+// Fill the clipped columns and rows of the Raster 'that' with the color
+// 'color'
+void RasterFill(
+    Raster* const that,
+  const uint32_t color);
+
+// Set the pixel at ('x', 'y') of the Raster 'that' to 'color' if it's
+// inside the Raster and its clipped columns
+static inline void RasterPlot(
+    Raster* const that,
+       const int x,
+       const int y,
+  const uint32_t color);
+
+// Draw the vertical line at 'x' from 'yMin' to 'yMax' in the Raster
+// 'that' with the color 'color'
+void RasterDrawVLine(
+    Raster* const that,
+     const float x,
+     const float yMin,
+     const float yMax,
+  const uint32_t color);
+
+// Draw the filled disc of center ('x', 'y') and radius 'radius' in the
+// Raster 'that' with the color 'color', using the selected kernels
+void RasterDrawDisc(
+    Raster* const that,
+     const float x,
+     const float y,
+     const float radius,
+  const uint32_t color);
+
+// Draw the 1 pixel wide cubic Bezier curve of control points 'ctrl'
+// (x0, y0, x1, y1, x2, y2, x3, y3) in the Raster 'that' with the color
+// 'color', using the selected kernels
+void RasterDrawCurve(
+     Raster* const that,
+  const float* const ctrl,
+      const uint32_t color);
+
+// Get the kernels for the instruction set 'name' (scalar, sse2, avx2,
+// or auto for the best one supported by the CPU)
+// Return NULL if the instruction set is unknown or not supported
+const RasterKernels* RasterGetKernels(const char* const name);
+
+// Select the kernels used by RasterDrawDisc and RasterDrawCurve
+void RasterSelectKernels(const RasterKernels* const kernels);
+
+// Get the nb of samples used to flatten the curve of control points
+// 'ctrl', about one every half pixel along its control polygon
+int RasterGetNbSampleCurve(const float* const ctrl);
+
+// Get in 'from' and 'to' the range of the 'nbSample' + 1 samples of the
+// curve of control points 'ctrl' which may be inside the clipped rows
+// of the Raster 'that'. The range is reduced only for the curves
+// monotonic along y, else it's all the samples
+void RasterGetRangeSampleCurve(
+   const Raster* const that,
+    const float* const ctrl,
+             const int nbSample,
+             int* const from,
+             int* const to);
+
+// Get the y coordinate of the sample 'iSample' of the 'nbSample' + 1
+// samples of the curve of control points 'ctrl', calculated as in the
+// curve kernels
+float RasterGetYSampleCurve(
+  const float* const ctrl,
+           const int iSample,
+           const int nbSample);
+
+// Fill the pixels 'ixMin' to 'ixMax' of the row 'iy' of the Raster
+// 'that' with the color 'color', clipped to the Raster and its clipped
+// columns
+static inline void RasterFillSpan(
+    Raster* const that,
+             int ixMin,
+             int ixMax,
+       const int iy,
+  const uint32_t color);
+
+// Scalar kernel for RasterDrawDisc
+void RasterDrawDiscScalar(
+    Raster* const that,
+     const float x,
+     const float y,
+     const float radius,
+  const uint32_t color);
+
+// Scalar kernel for RasterDrawCurve
+void RasterDrawCurveScalar(
+     Raster* const that,
+  const float* const ctrl,
+      const uint32_t color);
+
+// Scalar kernel adding the 4 bytes of each of the 'width' pixels of
+// 'row' to the 4 * 'width' sums 'sums', cf RasterDownscale
+void RasterAccumulateRowScalar(
+        uint32_t* const sums,
+  const uint32_t* const row,
+              const int width);
+
+#if RASTER_SIMD_X86
+
+// SSE2 kernel for RasterDrawDisc
+void RasterDrawDiscSSE2(
+    Raster* const that,
+     const float x,
+     const float y,
+     const float radius,
+  const uint32_t color);
+
+// SSE2 kernel for RasterDrawCurve
+void RasterDrawCurveSSE2(
+     Raster* const that,
+  const float* const ctrl,
+      const uint32_t color);
+
+// SSE2 kernel for RasterAccumulateRowScalar
+void RasterAccumulateRowSSE2(
+        uint32_t* const sums,
+  const uint32_t* const row,
+              const int width);
+
+// AVX2 kernel for RasterDrawDisc
+void RasterDrawDiscAVX2(
+    Raster* const that,
+     const float x,
+     const float y,
+     const float radius,
+  const uint32_t color);
+
+// AVX2 kernel for RasterDrawCurve
+void RasterDrawCurveAVX2(
+     Raster* const that,
+  const float* const ctrl,
+      const uint32_t color);
+
+// AVX2 kernel for RasterAccumulateRowScalar
+void RasterAccumulateRowAVX2(
+        uint32_t* const sums,
+  const uint32_t* const row,
+              const int width);
+
+#endif
+
+// Draw the same random discs and curves with each kernel supported by
+// the CPU and compare the result with the scalar kernel, then
+// accumulate the rows of the result with each kernel and compare the
+// sums with the scalar kernel
+// Return true if all the kernels are within tolerance, else false
+bool RasterCheckKernels(void);
+
+// Downscale the Raster 'that' into the Raster 'raster' with a box
+// filter, each pixel of 'raster' being the rounded average of the
+// block of pixels of 'that' it covers. The dimensions of 'that' must be
+// multiples of the ones of 'raster'
+void RasterDownscale(
+  const Raster* const that,
+        Raster* const raster);
+
+// Save the Raster 'that' at 'path' in the format 'format', the rows
+// being encoded by 'nbThread' threads
+// Return true if successfull, else false
+bool RasterSave(
+  const Raster* const that,
+    const char* const path,
+    const ImgFormat format,
+          const int nbThread);
+
+// Get the format of the image file at 'path' from its extension: PNG
+// for .png, else TGA
+ImgFormat ImgFormatFromPath(const char* const path);
+
+// Create a new ImgWriter writing the image of 'width' x 'height'
+// pixels in the format 'format' at 'path', encoding its rows with
+// 'nbThread' threads
+// Return NULL if the file couldn't be opened
+ImgWriter* ImgWriterCreate(
+  const char* const path,
+          const int width,
+          const int height,
+    const ImgFormat format,
+          const int nbThread);
+
+// Free the memory used by the ImgWriter 'that', closing its file if
+// it's still open
+void ImgWriterFree(ImgWriter** const that);
+
+// Add the next row 'row', of packed 0xAARRGGBB pixels, to the image of
+// the ImgWriter 'that', the rows being added from the top of the image
+// Return false if an error occured, else true
+bool ImgWriterAddRow(
+       ImgWriter* const that,
+  const uint32_t* const row);
+
+// Write the end of the image of the ImgWriter 'that' and close its
+// file
+// Return true if the whole image was written successfully, else false
+bool ImgWriterClose(ImgWriter* const that);
+
+// Encode in parallel and write the strips of rows waiting in the
+// ImgWriter 'that'
+void ImgWriterFlush(ImgWriter* const that);
+
+// Task encoding the strips of an ImgWriter, 'arg' is the ImgWriter
+void ImgWriterTaskEncode(
+      void* const arg,
+   const uint64_t from,
+   const uint64_t to,
+   const uint64_t iChunk);
+
+// Encode the strip 'strip' of the ImgWriter 'that' as run length
+// encoded TGA pixels, each row being encoded separately
+void ImgWriterEncodeTga(
+  const ImgWriter* const that,
+       ImgStrip* const strip);
+
+// Encode the strip 'strip' of the ImgWriter 'that' as deflate blocks
+// ending on a byte boundary, which can be concatenated with the ones of
+// the other strips, the raw bytes preceding the strip being used as
+// dictionary
+void ImgWriterEncodePng(
+  const ImgWriter* const that,
+       ImgStrip* const strip);
+
+// Write the PNG chunk of type 'type' and data 'data' of 'size' bytes
+// in the stream 'stream'
+// Return true if successfull, else false
+bool ImgWriterWritePngChunk(
+           FILE* const stream,
+     const char* const type,
+  const unsigned char* const data,
+         const uint32_t size);
+
+// Create a new SvgWriter writing at 'path'
+// Return NULL if the file couldn't be opened
+SvgWriter* SvgWriterCreate(const char* const path);
+
+// Free the memory used by the SvgWriter 'that', closing its file if
+// it's still open
+void SvgWriterFree(SvgWriter** const that);
+
+// Add the string 'str' to the SvgWriter 'that'
+void SvgWriterAddStr(
+   SvgWriter* const that,
+  const char* const str);
+
+// Add the number 'val' to the SvgWriter 'that', rounded to 2 decimals
+// without the trailing zeros
+void SvgWriterAddNum(
+  SvgWriter* const that,
+       const float val);
+
+// Write the text buffered in the SvgWriter 'that'
+void SvgWriterFlush(SvgWriter* const that);
+
+// Write the text still buffered in the SvgWriter 'that' and close its
+// file
+// Return true if the whole file was written successfully, else false
+bool SvgWriterClose(SvgWriter* const that);
+
+// Create a static HistReader reading the stream 'stream'
+HistReader HistReaderCreateStatic(FILE* const stream);
+
+// Get the next character of the HistReader 'that' without consuming it
+// Return EOF if there is no more data
+int HistReaderPeek(HistReader* const that);
+
+// Skip the white spaces in the HistReader 'that'
+// Return the next character without consuming it
+int HistReaderSkipSpace(HistReader* const that);
+
+// Consume the next non white space character of the HistReader 'that'
+// if it's equal to 'c'
+// Return true if it was consumed, else false
+bool HistReaderExpect(
+  HistReader* const that,
+          const int c);
+
+// Read a string in the HistReader 'that' and copy it into 'str' of
+// size 'size', truncating it if necessary
+// Return true if successfull, else false
+bool HistReaderReadString(
+  HistReader* const that,
+        char* const str,
+       const size_t size);
+
+// Read an unsigned integer, quoted or not, in the HistReader 'that'
+// and copy it into 'val'
+// Return true if successfull, else false
+bool HistReaderReadULong(
+      HistReader* const that,
+  unsigned long* const val);
+
+// Skip the next JSON value in the HistReader 'that'
+// Return true if successfull, else false
+bool HistReaderSkipValue(HistReader* const that);
+
+// Read the array of births in the HistReader 'that' and add them
+// to the GAViewer 'viewer'
+// Return true if successfull, else false
+bool HistReaderReadGenealogy(
+  HistReader* const that,
+    GAViewer* const viewer);
+
+// Read the births in the HistReader 'that', up to the end of the
+// genealogy array excluded, and add them to the GAViewer 'viewer'
+// Return true if successfull, else false
+bool HistReaderReadBirths(
+  HistReader* const that,
+    GAViewer* const viewer);
+
+// Function to create a new GAViewer,
+// Return a pointer to the new GAViewer
+GAViewer* GAViewerCreate(void) {
+
+  // Allocate memory for the CBo
+  GAViewer* that =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(GAViewer));
+
+  // Init the properties
+  that->pathHistory = NULL;
+  that->pathHistoryImg = NULL;
+  that->formatHistoryImg = ImgFormatTga;
+  that->pathHistoryBin = NULL;
+  that->dimHistoryImg[0] = DEFAULT_DIMHISTORYIMG;
+  that->dimHistoryImg[1] = DEFAULT_DIMHISTORYIMG;
+  that->nodes = NodeStoreCreateStatic();
+  that->nbEpoch = 0;
+  that->maxId = 0;
+  that->nbNode = 0;
+  that->offsetLastBirth = 0;
+  that->fromEpoch = 0;
+  that->toEpoch = 0;
+  that->loadFromEpoch = 0;
+  that->loadToEpoch = ULONG_MAX;
+  that->epochIndex = EpochIndexCreateStatic();
+  that->isInfo = false;
+  that->renderer = GAViewerRendererGenBrush;
+  that->nbThread = 1;
+  that->isLod = true;
+  that->isTiles = false;
+  that->tilesFromEpoch = 0;
+  that->tilesToEpoch = 0;
+  that->isFollow = false;
+  that->followInterval = 0.0;
+  that->followToEpoch = 0;
+  that->jobs = NULL;
+  that->nbJob = 0;
+  that->isTrace = false;
+  that->traceId = 0;
+  that->traceEpoch = 0;
+  that->isTraceDescendants = false;
+  that->traceBits = NULL;
+  that->traceFirstNode = 0;
+  that->traceNbNode = 0;
+  that->isGui = false;
+  that->isOneEpochPerColumn = false;
+  that->pathOoc = NULL;
+  that->oocRuns = NULL;
+
+  // Return the new GAViewer
+  return that;
+
+}
+
+// Function to free the memory used by the GAViewer 'that'
+void GAViewerFree(GAViewer** const that) {
+
+  if (that == NULL || *that == NULL) return;
+
+  // Free memory
+  if ((*that)->pathHistory != NULL) {
+
+    free((*that)->pathHistory);
+
+  }
+
+  if ((*that)->pathHistoryImg != NULL) {
+
+    free((*that)->pathHistoryImg);
+
+  }
+
+  if ((*that)->pathHistoryBin != NULL) {
+
+    free((*that)->pathHistoryBin);
+
+  }
+
+  GAViewerFreeNodes(*that);
+  EpochIndexFree(&((*that)->epochIndex));
+  GAViewerFreeJobs(*that);
+  free((*that)->traceBits);
+  free((*that)->pathOoc);
+  OocRunsFree(&((*that)->oocRuns));
+
+  free(*that);
+
+}
+
+// Process the prior arguments from the command line
+// Return true if the arguments were correct, else false
+bool GAViewerProcessPriorCmdLineArguments(
+     GAViewer* const that,
+           const int argc,
+  const char** const argv) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Loop on arguments
+  for (
+    int iArg = 1;
+    iArg < argc;
+    ++iArg) {
+
+    int retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-help");
+    if (retStrCmp == 0) {
+
+      printf("gaviewer\n");
+      printf("[-help] : print the help message\n");
+      printf("[-hist] : path to the history file generated by " \
+        "GenAlg.GASaveHistory, or to its binary conversion\n");
+      printf(
+        "[-toBin <path/to/hist.gah>] : convert the history to a binary " \
+        "history and save it to the specified path, only the births " \
+        "appended since the last conversion are decoded\n");
+      printf(
+        "[-toImg <path/to/img.tga|png>] : convert the history to an " \
+        "image and save it to the specified path, as PNG if its " \
+        "extension is .png, else as run length encoded TGA\n");
+      printf(
+        "[-size <width,height>] : size in pixel of the generated image " \
+        "(square), default is 800px\n");
+      printf("[-from <epoch>] : first displayed epoch\n");
+      printf("[-to <epoch>] : last displayed epoch\n");
+      printf(
+        "[-toTiles <path/to/dir>] : convert the whole history to a " \
+        "Deep Zoom image pyramid of 256px PNG tiles saved in the " \
+        "specified directory, -from and -to selecting the epochs " \
+        "whose tiles are drawn\n");
+      printf(
+        "[-toSvg <path/to/img.svg>] : save the history as a SVG " \
+        "image of the size given by -size, with the layout of the " \
+        "direct renderer, streamed to the file epoch by epoch\n");
+      printf(
+        "[-gui] : display the history in a window, drag with the " \
+        "left button, zoom with the wheel (Shift: along x only, Ctrl: " \
+        "along y only), hover a node to describe it, Home to reset " \
+        "the view, q to quit\n");
+      printf(
+        "[-outOfCore <dir>] : create the image given by -toImg without " \
+        "holding the history in memory: the births are sorted by epoch " \
+        "into run files in the directory, then merged and ranked one " \
+        "epoch at a time into a layout file drawn one epoch at a time " \
+        "with the direct renderer (JSON history only)\n");
+      printf(
+        "[-follow <seconds>] : keep the history in memory and watch " \
+        "its file, and each time it grows load the appended births, " \
+        "rank the new epochs and redraw the image of -toImg from the " \
+        "first changed epoch with the direct renderer, at most every " \
+        "given seconds, until interrupted\n");
+      printf(
+        "[-jobs <path/to/jobs.txt>] : load the history once and run " \
+        "the renders listed in the file with the direct renderer, " \
+        "one per line as '<from> <to> <width>,<height> " \
+        "<path/to/img.tga|png>' (to 0 for the last epoch), the renders " \
+        "of different ranges in parallel with -threads and the sizes " \
+        "dividing a larger one of the same range downscaled from it\n");
+      printf(
+        "[-renderer <genbrush|direct|strips>] : renderer used to " \
+        "create the image, genbrush (default, up to 32767px per side), " \
+        "direct which draws straight into a pixel buffer, or strips " \
+        "which draws like direct one strip of 64MB of pixels at a time " \
+        "streamed to the file, for posters larger than the memory\n");
+      printf(
+        "[-threads <nb>] : nb of threads grouping the births by " \
+        "epoch, searching their fathers, drawing the image with " \
+        "the direct renderer and compressing it, default is 1\n");
+      printf(
+        "[-lod <auto|off>] : with auto (default), the direct " \
+        "renderer aggregates the epochs with more nodes than rows " \
+        "of pixels into rows and bundles of edges\n");
+      printf(
+        "[-kernels <auto|avx2|sse2|scalar>] : instruction set used " \
+        "by the direct renderer, default is auto\n");
+      printf(
+        "[-checkKernels] : compare the vectorized kernels of the " \
+        "direct renderer with the scalar ones\n");
+      printf(
+        "[-stats <text|json>] : print at the end the wall and CPU " \
+        "time and the peak RSS of each phase, with the nb of node " \
+        "lookups and their average nb of comparisons, of shapoids " \
+        "and curves, and of pixels written\n");
+      printf(
+        "[-statsCsv <path/to/stats.csv>] : save the statistics of " \
+        "each displayed epoch as CSV (nodes, births, survivors, " \
+        "distinct fathers, distribution of the nb of births per " \
+        "father, surviving founder lineages) without rendering\n");
+      printf(
+        "[-trace <id@epoch> [ancestors|descendants]] : print the " \
+        "ancestors (default) or descendants of the node id born at " \
+        "epoch over the loaded epochs, the images showing only them\n");
+      printf(
+        "[-info] : print the summary of the history (nb of epochs, " \
+        "nb of births, max id, nb of births per epoch) without " \
+        "rendering it\n");
+      printf(
+        "[-benchSearch <nbNode>] : benchmark the search of nodes on " \
+        "a synthetic history with nbNode nodes per epoch\n");
+      printf(
+        "[-benchRank] : benchmark the sort of the nodes of an epoch " \
+        "on synthetic epochs of 10^3 to 10^6 nodes\n");
+      printf(
+        "[-benchPhases <path/to/results.csv>] : benchmark separately " \
+        "the parse, node conversion, ranking, rendering and save of " \
+        "synthetic histories of 100 epochs of 10^3 to 10^5 " \
+        "individuals with -threads, and save the times as CSV\n");
+      printf(
+        "[-genHistory <nbEpoch,nbPop,eliteRatio,idReuse> " \
+        "<path/to/hist.json>] : generate a synthetic history of " \
+        "nbEpoch epochs of nbPop individuals, the eliteRatio best " \
+        "ones surviving and the other ones replaced by children " \
+        "of the elites taking the id of a dead individual with the " \
+        "probability idReuse\n");
+      printf("\n");
+
+    }
+
+    // If the argument is -benchSearch
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-benchSearch");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      // Decode the number of nodes
+      int nbNode = atoi(argv[iArg + 1]);
+
+      // If the number of nodes is valid
+      if (nbNode > 0) {
+
+        // Run the benchmark
+        GAViewerBenchSearch(nbNode);
+
+      // Else, the number of nodes is not valid
+      } else {
+
+        fprintf(
+          stderr,
+          "The number of nodes [%s] is incorrect\n",
+          argv[iArg + 1]);
+        return false;
+
+      }
+
+    }
+
+    // If the argument is -benchRank
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-benchRank");
+    if (retStrCmp == 0) {
+
+      GAViewerBenchRank();
+
+    }
+
+    // If the argument is -benchPhases
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-benchPhases");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      bool retBench =
+        GAViewerBenchPhases(
+          argv[iArg + 1],
+          that->nbThread);
+      if (retBench == false) {
+
+        return false;
+
+      }
+
+    }
+
+    // If the argument is -genHistory
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-genHistory");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 2) {
+
+      // Decode the parameters of the history
+      unsigned long nbEpoch = 0;
+      unsigned long nbPop = 0;
+      float eliteRatio = 0.0f;
+      float idReuse = 0.0f;
+      int nbRead =
+        sscanf(
+          argv[iArg + 1],
+          "%lu,%lu,%f,%f",
+          &nbEpoch,
+          &nbPop,
+          &eliteRatio,
+          &idReuse);
+
+      // If the parameters are valid
+      if (
+        nbRead == 4 &&
+        nbEpoch > 0 &&
+        nbPop > 0 &&
+        eliteRatio > 0.0f &&
+        eliteRatio <= 1.0f &&
+        idReuse >= 0.0f &&
+        idReuse <= 1.0f) {
+
+        bool retGen =
+          GAViewerGenHistory(
+            argv[iArg + 2],
+            nbEpoch,
+            nbPop,
+            eliteRatio,
+            idReuse);
+        if (retGen == false) {
+
+          fprintf(
+            stderr,
+            "Couldn't generate the history [%s]\n",
+            argv[iArg + 2]);
+          return false;
+
+        }
+
+        printf(
+          "Generated the history [%s]\n",
+          argv[iArg + 2]);
+
+      // Else, the parameters are not valid
+      } else {
+
+        fprintf(
+          stderr,
+          "The parameters [%s] are incorrect\n",
+          argv[iArg + 1]);
+        return false;
+
+      }
+
+    }
+
+    // If the argument is -hist
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-hist");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      // Try to open the file to check the path
+      FILE* stream =
+        fopen(
+          argv[iArg + 1],
+          "r");
+
+      // If the path is correct
+      if (stream != NULL) {
+
+        // Update the path to history file
+        free(that->pathHistory);
+        that->pathHistory = strdup(argv[iArg + 1]);
+
+        // Close the stream, the history is loaded once all the
+        // arguments are known
+        fclose(stream);
+
+      // Else the path is incorrect
+      } else {
+
+        fprintf(
+          stderr,
+          "The path [%s] is incorrect\n",
+          argv[iArg + 1]);
+        return false;
+
+      }
+
+    }
+
+    // If the argument is -renderer
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-renderer");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      ++iArg;
+      if (
+        strcmp(
+          argv[iArg],
+          "direct") == 0) {
+
+        that->renderer = GAViewerRendererDirect;
+
+      } else if (
+        strcmp(
+          argv[iArg],
+          "strips") == 0) {
+
+        that->renderer = GAViewerRendererStrips;
+
+      } else if (
+        strcmp(
+          argv[iArg],
+          "genbrush") == 0) {
+
+        that->renderer = GAViewerRendererGenBrush;
+
+      } else {
+
+        fprintf(
+          stderr,
+          "Invalid renderer [%s]\n",
+          argv[iArg]);
+        return false;
+
+      }
+
+    }
+
+    // If the argument is -threads
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-threads");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      ++iArg;
+      int nbThread = atoi(argv[iArg]);
+      if (nbThread <= 0) {
+
+        fprintf(
+          stderr,
+          "The number of threads [%s] is incorrect\n",
+          argv[iArg]);
+        return false;
+
+      }
+
+      that->nbThread = nbThread;
+
+    }
+
+    // If the argument is -lod
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-lod");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      ++iArg;
+      if (
+        strcmp(
+          argv[iArg],
+          "auto") == 0) {
+
+        that->isLod = true;
+
+      } else if (
+        strcmp(
+          argv[iArg],
+          "off") == 0) {
+
+        that->isLod = false;
+
+      } else {
+
+        fprintf(
+          stderr,
+          "Invalid LOD mode [%s]\n",
+          argv[iArg]);
+        return false;
+
+      }
+
+    }
+
+    // If the argument is -kernels
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-kernels");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      ++iArg;
+      const RasterKernels* kernels = RasterGetKernels(argv[iArg]);
+      if (kernels == NULL) {
+
+        fprintf(
+          stderr,
+          "Invalid or unsupported kernels [%s]\n",
+          argv[iArg]);
+        return false;
+
+      }
+
+      RasterSelectKernels(kernels);
+
+    }
+
+    // If the argument is -checkKernels
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-checkKernels");
+    if (retStrCmp == 0) {
+
+      bool retCheck = RasterCheckKernels();
+      if (retCheck == false) {
+
+        return false;
+
+      }
+
+    }
+
+    // If the argument is -stats
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-stats");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      ++iArg;
+      if (strcmp(argv[iArg], "text") == 0) {
+
+        StatsEnable(StatsFormatText);
+
+      } else if (strcmp(argv[iArg], "json") == 0) {
+
+        StatsEnable(StatsFormatJson);
+
+      } else {
+
+        fprintf(
+          stderr,
+          "Invalid stats format [%s]\n",
+          argv[iArg]);
+        return false;
+
+      }
+
+    }
+
+    // If the argument is -info
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-info");
+    if (retStrCmp == 0) {
+
+      that->isInfo = true;
+
+    }
+
+    // If the argument is -gui, the window is displayed with the
+    // posterior arguments
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-gui");
+    if (retStrCmp == 0) {
+
+      that->isGui = true;
+
+    }
+
+    // If the argument is -outOfCore
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-outOfCore");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      free(that->pathOoc);
+      that->pathOoc = strdup(argv[iArg + 1]);
+
+    }
+
+    // If the argument is -toBin
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-toBin");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      // Update the path to the binary history file
+      free(that->pathHistoryBin);
+      that->pathHistoryBin = strdup(argv[iArg + 1]);
+
+    }
+
+    // If the argument is -size
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-size");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      // Decode the size
+      int size[2] = {0, 0};
+      char* posComma =
+        strchr(
+          argv[iArg + 1],
+          ',');
+      if (posComma != NULL) {
+
+        *posComma = '\0';
+        size[0] = atoi(argv[iArg + 1]);
+        *posComma = ',';
+        size[1] = atoi(posComma + 1);
+
+        // If the size is valid
+        if (size[0] > 0 && size[1] > 0) {
+
+          // Set the size
+          that->dimHistoryImg[0] = size[0];
+          that->dimHistoryImg[1] = size[1];
+
+        // Else, the size is not valid
+        } else {
+
+          fprintf(
+            stderr,
+            "The size [%s] is incorrect\n",
+            argv[iArg + 1]);
+          return false;
+
+        }
+
+      } else {
+
+          fprintf(
+            stderr,
+            "The size [%s] is incorrect\n",
+            argv[iArg + 1]);
+          return false;
+
+      }
+
+    }
+
+    // If the argument is -from
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-from");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      // Decode the epoch
+      that->fromEpoch = atoi(argv[iArg + 1]);
+
+    }
+
+    // If the argument is -to
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-to");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      // Decode the epoch
+      that->toEpoch = atoi(argv[iArg + 1]);
+
+    }
+
+    // If the argument is -toTiles, the image pyramid is created with
+    // the posterior arguments
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-toTiles");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      that->isTiles = true;
+
+    }
+
+    // If the argument is -follow
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-follow");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      // Decode the interval between two updates of the image
+      double interval = atof(argv[iArg + 1]);
+      if (interval > 0.0) {
+
+        that->isFollow = true;
+        that->followInterval = interval;
+
+      } else {
+
+        fprintf(
+          stderr,
+          "The interval [%s] is incorrect\n",
+          argv[iArg + 1]);
+        return false;
+
+      }
+
+    }
+
+    // If the argument is -trace
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-trace");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      // Decode the node, and the direction of the trace if given
+      int posEnd = 0;
+      int nbRead =
+        sscanf(
+          argv[iArg + 1],
+          "%lu@%lu%n",
+          &(that->traceId),
+          &(that->traceEpoch),
+          &posEnd);
+      if (
+        nbRead != 2 ||
+        argv[iArg + 1][posEnd] != '\0') {
+
+        fprintf(
+          stderr,
+          "The traced node [%s] is incorrect\n",
+          argv[iArg + 1]);
+        return false;
+
+      }
+
+      that->isTrace = true;
+      that->isTraceDescendants = false;
+      ++iArg;
+      if (iArg < argc - 1) {
+
+        if (strcmp(argv[iArg + 1], "descendants") == 0) {
+
+          that->isTraceDescendants = true;
+          ++iArg;
+
+        } else if (strcmp(argv[iArg + 1], "ancestors") == 0) {
+
+          ++iArg;
+
+        }
+
+      }
+
+    }
+
+    // If the argument is -jobs, the jobs are loaded now to load the
+    // range of epochs they cover, and run with the posterior arguments
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-jobs");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      bool retJobs =
+        GAViewerLoadJobs(
+          that,
+          argv[iArg + 1]);
+      if (retJobs == false) {
+
+        return false;
+
+      }
+
+    }
+
+  }
+
+  // If there are jobs, the history is loaded from the first epoch of
+  // the jobs up to their last one
+  if (that->nbJob > 0) {
+
+    that->fromEpoch = that->jobs[0].fromEpoch;
+    that->toEpoch = that->jobs[0].toEpoch;
+    for (
+      int iJob = 1;
+      iJob < that->nbJob;
+      ++iJob) {
+
+      that->fromEpoch =
+        MIN(
+          that->fromEpoch,
+          that->jobs[iJob].fromEpoch);
+      if (
+        that->toEpoch > 0 &&
+        that->jobs[iJob].toEpoch > 0) {
+
+        that->toEpoch =
+          MAX(
+            that->toEpoch,
+            that->jobs[iJob].toEpoch);
+
+      } else {
+
+        that->toEpoch = 0;
+
+      }
+
+    }
+
+  }
+
+  // The out-of-core mode only creates images, as the nodes are never
+  // all in memory
+  if (
+    that->pathOoc != NULL &&
+    (that->isTiles == true ||
+    that->isFollow == true ||
+    that->isTrace == true ||
+    that->isGui == true ||
+    that->nbJob > 0 ||
+    that->pathHistoryBin != NULL)) {
+
+    fprintf(
+      stderr,
+      "The out-of-core mode only creates images with -toImg\n");
+    return false;
+
+  }
+
+  // If the image pyramid is requested, the whole history is displayed
+  // and the range of epochs only selects the tiles to draw
+  if (that->isTiles == true) {
+
+    that->tilesFromEpoch = that->fromEpoch;
+    that->tilesToEpoch = that->toEpoch;
+    that->fromEpoch = 0;
+    that->toEpoch = 0;
+
+  }
+
+  // If the history is followed, it's loaded up to its end to know
+  // where the next births are appended, and the last epoch specified
+  // by the user only fixes the layout
+  if (that->isFollow == true) {
+
+    that->followToEpoch = that->toEpoch;
+    that->toEpoch = 0;
+
+  }
+
+  // If only the summary of the history is requested
+  if (
+    that->pathHistory != NULL &&
+    that->isInfo == true) {
+
+    bool retInfo = GAViewerLoadInfo(that);
+    if (retInfo == false) {
+
+      fprintf(
+        stderr,
+        "Couldn't load the history [%s]\n",
+        that->pathHistory);
+      return false;
+
+    }
+
+    GAViewerPrintInfo(
+      that,
+      stdout);
+    return true;
+
+  }
+
+  // If there is a history, load it
+  if (that->pathHistory != NULL) {
+
+    bool retLoad =
+      (that->pathOoc != NULL ?
+        GAViewerLoadOutOfCore(that) :
+        GAViewerLoad(that));
+
+    // If we failed to load the history
+    if (retLoad == false) {
+
+      fprintf(
+        stderr,
+        "Couldn't load the history [%s]\n",
+        that->pathHistory);
+      return false;
+
+    // Else, we could load the history
+    } else {
+
+      printf(
+        "Loaded the history [%s]\n",
+        that->pathHistory);
+
+    }
+
+  }
+
+  // If the user hasn't specified a last epoch
+  if (that->toEpoch == 0) {
+
+    // Set it to the last epoch
+    that->toEpoch = that->nbEpoch - 1;
+
+  }
+
+  // Ensure the last displayed epoch is not greater than the
+  // last epoch
+  that->toEpoch =
+    MIN(
+      that->toEpoch,
+      that->nbEpoch - 1);
+
+  // Same for the last epoch whose tiles are drawn
+  if (that->tilesToEpoch == 0) {
+
+    that->tilesToEpoch = that->nbEpoch - 1;
+
+  }
+
+  that->tilesToEpoch =
+    MIN(
+      that->tilesToEpoch,
+      that->nbEpoch - 1);
+
+  // Return the successfull code
+  return true;
+
+}
+
+// Process the posterior arguments from the command line
+// Return true if the arguments were correct, else false
+bool GAViewerProcessPosteriorCmdLineArguments(
+     GAViewer* const that,
+           const int argc,
+  const char** const argv) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // If only the summary of the history was requested, there is
+  // nothing else to do
+  if (that->isInfo == true) {
+
+    return true;
+
+  }
+
+  // If a lineage is traced, trace it before the images are created, so
+  // they show only the traced nodes
+  if (that->isTrace == true) {
+
+    StatsStartPhase("trace");
+    bool ret = GAViewerTrace(that);
+    if (ret == false) {
+
+      fprintf(
+        stderr,
+        "Failed to trace the lineage\n");
+      return false;
+
+    }
+
+  }
+
+  // Loop on arguments
+  for (
+    int iArg = 1;
+    iArg < argc;
+    ++iArg) {
+
+    int retStrCmp =
+      strcmp(
         argv[iArg],
         "-toImg");
     if (
-      retStrCmp == 0 &&
-      iArg < argc - 1) {
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      // Try to open the file to check the path
+      FILE* stream =
+        fopen(
+          argv[iArg + 1],
+          "w");
+
+      // If the path is correct
+      if (stream != NULL) {
+
+        // Update the path to history image file, and get its format
+        // from its extension
+        free(that->pathHistoryImg);
+        that->pathHistoryImg = strdup(argv[iArg + 1]);
+        that->formatHistoryImg = ImgFormatFromPath(that->pathHistoryImg);
+
+        // Close the stream
+        fclose(stream);
+
+        // Create the image from history, unless the history is
+        // followed in which case it's created by the follow mode
+        bool ret =
+          that->isFollow ||
+          (that->pathOoc != NULL ?
+            GAViewerHistoryToImgOutOfCore(that) :
+            GAViewerHistoryToImg(that));
+        if (ret == false) {
+
+          fprintf(
+            stderr,
+            "Failed to create the history image\n");
+          return false;
+
+        }
+
+      // Else the path is incorrect
+      } else {
+
+        fprintf(
+          stderr,
+          "The path [%s] is incorrect\n",
+          argv[iArg + 1]);
+        return false;
+
+      }
+
+    }
+
+    // If the argument is -toTiles
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-toTiles");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      // Create the image pyramid from history
+      bool ret =
+        GAViewerHistoryToTiles(
+          that,
+          argv[iArg + 1]);
+      if (ret == false) {
+
+        fprintf(
+          stderr,
+          "Failed to create the history image pyramid\n");
+        return false;
+
+      }
+
+    }
+
+    // If the argument is -toSvg
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-toSvg");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      // Save the history as a SVG image, which needs the nodes in memory
+      if (that->pathOoc != NULL) {
+
+        fprintf(
+          stderr,
+          "The out-of-core mode only creates images with -toImg\n");
+        return false;
+
+      }
+
+      bool ret =
+        GAViewerHistoryToSvg(
+          that,
+          argv[iArg + 1]);
+      if (ret == false) {
+
+        fprintf(
+          stderr,
+          "Failed to create the history SVG image\n");
+        return false;
+
+      }
+
+    }
+
+    // If the argument is -statsCsv
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-statsCsv");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      // Save the statistics of the epochs, which needs the nodes in
+      // memory
+      if (that->pathOoc != NULL) {
+
+        fprintf(
+          stderr,
+          "The out-of-core mode only creates images with -toImg\n");
+        return false;
+
+      }
+
+      bool ret =
+        GAViewerHistoryToStatsCsv(
+          that,
+          argv[iArg + 1]);
+      if (ret == false) {
+
+        fprintf(
+          stderr,
+          "Failed to save the statistics of the history\n");
+        return false;
+
+      }
+
+    }
+
+    // If the argument is -jobs
+    retStrCmp =
+      strcmp(
+        argv[iArg],
+        "-jobs");
+    if (
+      retStrCmp == 0 &&
+      iArg < argc - 1) {
+
+      // Run the jobs on the loaded history
+      bool ret = GAViewerRunJobs(that);
+      if (ret == false) {
+
+        fprintf(
+          stderr,
+          "Failed to run the jobs\n");
+        return false;
+
+      }
+
+    }
+
+  }
+
+  // If requested, display the history in the interactive window
+  if (that->isGui == true) {
+
+    bool ret = GAViewerShowWindow(that);
+    if (ret == false) {
+
+      fprintf(
+        stderr,
+        "Failed to display the history\n");
+      return false;
+
+    }
+
+  }
+
+  // If the history is followed, update its image each time it grows
+  if (that->isFollow == true) {
+
+    bool ret = GAViewerFollow(that);
+    if (ret == false) {
+
+      fprintf(
+        stderr,
+        "Failed to follow the history\n");
+      return false;
+
+    }
+
+  }
+
+  // Return the successfull code
+  return true;
+
+}
+
+// Create the image from the history
+// Return true if successfull, else false
+bool GAViewerHistoryToImg(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Draw the history with the selected renderer
+  bool ret = false;
+  switch (that->renderer) {
+
+    case GAViewerRendererDirect:
+      ret = GAViewerHistoryToImgDirect(that);
+      break;
+
+    case GAViewerRendererStrips:
+      ret = GAViewerHistoryToImgStrips(that);
+      break;
+
+    default:
+      ret = GAViewerHistoryToImgGenBrush(that);
+      break;
+
+  }
+
+  // Return the success code
+  return ret;
+
+}
+
+// Create the image from the history with GenBrush objects
+// Return true if successfull, else false
+bool GAViewerHistoryToImgGenBrush(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (that->pathHistoryImg == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that->pathHistory' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // The surface of GenBrush has 16 bits dimensions
+  if (
+    that->dimHistoryImg[0] > SHRT_MAX ||
+    that->dimHistoryImg[1] > SHRT_MAX) {
+
+    fprintf(
+      stderr,
+      "The genbrush renderer is limited to %dpx per side, use " \
+      "-renderer direct or strips\n",
+      SHRT_MAX);
+    return false;
+
+  }
+
+  StatsStartPhase("shapes");
+
+  // Create the GenBrush
+  VecShort2D dim = VecShortCreateStatic2D();
+  VecSet(
+    &dim,
+    0,
+    that->dimHistoryImg[0]);
+  VecSet(
+    &dim,
+    1,
+    that->dimHistoryImg[1]);
+  GenBrush* gb = GBCreateImage(&dim);
+
+  // Get the surface of the GenBrush
+  GBSurface* surf = GBSurf(gb);
+
+  // Create the objects used to draw the genealogy
+  GBPixel colorEpoch = GBColorWhite;
+  colorEpoch._rgba[GBPixelRed] = 202;
+  colorEpoch._rgba[GBPixelGreen] = 202;
+  colorEpoch._rgba[GBPixelBlue] = 202;
+  GBInkSolid* inkEpoch = GBInkSolidCreate(&colorEpoch);
+  GBPixel colorBirth = GBColorBlack;
+  GBInkSolid* inkBirth = GBInkSolidCreate(&colorBirth);
+  GBPixel colorSurvive = GBColorRed;
+  GBInkSolid* inkSurvive = GBInkSolidCreate(&colorSurvive);
+  GBToolPlotter* tool = GBToolPlotterCreate();
+  GBEyeOrtho* eye = GBEyeOrthoCreate(GBEyeOrthoViewFront);
+  GBHand hand = GBHandCreateStatic(GBHandTypeDefault);
+
+  // Create the layer for the epochs
+  GBLayer* layerEpoch =
+    GBSurfaceAddLayer(
+      surf,
+      GBDim(gb));
+  GBLayerSetStackPos(
+    layerEpoch,
+    GBLayerStackPosFg);
+  GBLayerSetBlendMode(
+    layerEpoch,
+    GBLayerBlendModeOver);
+
+  // Create the layer for the births
+  GBLayer* layerBirth =
+    GBSurfaceAddLayer(
+      surf,
+      GBDim(gb));
+  GBLayerSetStackPos(
+    layerEpoch,
+    GBLayerStackPosBg);
+  GBLayerSetBlendMode(
+    layerEpoch,
+    GBLayerBlendModeOver);
+
+  // Create a GSet to keep track of the curves
+  GSet curves = GSetCreateStatic();
+
+  // Create a GSet to keep track of the shapoids
+  GSet shapoids = GSetCreateStatic();
+
+  // Vector to do computation
+  VecFloat3D v = VecFloatCreateStatic3D();
+
+  // Calculate the step along x between two epochs
+  float stepXEpoch =
+    (float)(that->dimHistoryImg[0]) /
+    (float)(that->toEpoch - that->fromEpoch + 1);
+
+  // Calculate the bottom and top of the epoch curve
+  float yMinEpoch =
+    0.01 *
+    (float)(that->dimHistoryImg[1]);
+  float yMaxEpoch =
+    0.99 *
+    (float)(that->dimHistoryImg[1]);
+
+  // Loop on epochs
+  for (
+    unsigned long iEpoch = that->fromEpoch;
+    iEpoch <= that->toEpoch && iEpoch < that->nbEpoch;
+    ++iEpoch) {
+
+    // Declare a variable to memorize the shifted index of epoch
+    // according to the first displlayed epoch
+    unsigned long jEpoch = iEpoch - that->fromEpoch;
+
+    // Create the curve for the epoch
+    SCurve* curve =
+      SCurveCreate(
+        1,
+        3,
+        1);
+    GSetPush(
+      &curves,
+      curve);
+
+    // Set the position of the control points
+    VecSet(
+      &v,
+      0,
+      stepXEpoch * ((float)jEpoch + 0.5));
+    VecSet(
+      &v,
+      1,
+      yMinEpoch);
+    SCurveSetCtrl(
+      curve,
+      0,
+      (VecFloat*)&v);
+    VecSet(
+      &v,
+      1,
+      yMaxEpoch);
+    SCurveSetCtrl(
+      curve,
+      1,
+      (VecFloat*)&v);
+
+    // Create the pod for this curve
+    GBObjPod* pod =
+      GBAddSCurve(
+        gb,
+        curve,
+        &eye,
+        &hand,
+        tool,
+        inkEpoch,
+        layerEpoch);
+
+    // Declare some parameters to calculate the position of the node
+    // and of its father
+    const NodeStore* store = &(that->nodes);
+    uint64_t first = store->first[iEpoch];
+    uint32_t nbNode = store->first[iEpoch + 1] - first;
+    float stepYEpoch =
+      (float)(that->dimHistoryImg[1]) /
+      (float)nbNode;
+    float radiusCircle = stepYEpoch * 0.25;
+    uint64_t firstPrev = 0;
+    float stepYPrev = 0.0;
+    if (jEpoch > 0) {
+
+      firstPrev = store->first[iEpoch - 1];
+      stepYPrev =
+        (float)(that->dimHistoryImg[1]) /
+        (float)(first - firstPrev);
+
+    }
+
+    // Loop on the birth for this epoch, in their rank order
+    VecFloat3D posNode = VecFloatCreateStatic3D();
+    VecFloat3D posFather = VecFloatCreateStatic3D();
+    for (
+      uint32_t iRank = 0;
+      iRank < nbNode;
+      ++iRank) {
+
+      // Get the node, and skip it if it's not in the traced lineage
+      uint64_t iNode = first + store->order[first + iRank];
+      if (GAViewerIsTraced(that, iNode) == false) {
+
+        continue;
+
+      }
+
+      // Calculate the position of the node
+      VecSet(
+        &posNode,
+        0,
+        stepXEpoch * ((float)jEpoch + 0.5));
+      VecSet(
+        &posNode,
+        1,
+        stepYEpoch * ((float)iRank + 0.5));
+
+      // Create the circle for this node
+      Spheroid* circle = SpheroidCreate(2);
+      GSetPush(
+        &shapoids,
+        circle);
+      VecFloat2D w = VecFloatCreateStatic2D();
+      VecSet(
+        &w,
+        0,
+        radiusCircle);
+      VecSet(
+        &w,
+        1,
+        radiusCircle);
+      ShapoidScale(
+        circle,
+        (VecFloat*)&w);
+      VecSet(
+        &w,
+        0,
+        VecGet(
+          &posNode,
+          0));
+      VecSet(
+        &w,
+        1,
+        VecGet(
+          &posNode,
+          1));
+      ShapoidTranslate(
+        circle,
+        (VecFloat*)&w);
+      pod =
+        GBAddShapoid(
+          gb,
+          circle,
+          &eye,
+          &hand,
+          tool,
+          inkBirth,
+          layerBirth);
+
+      // Get the parent node
+      uint32_t father = store->fatherIdx[iNode];
+
+      // If we are not on the first displayed epoch and the node has
+      // a parent
+      if (
+        jEpoch > 0 &&
+        father != NODE_NONE) {
+
+        // Calculate the position of the father
+        VecSet(
+          &posFather,
+          0,
+          stepXEpoch * ((float)jEpoch - 0.5));
+        VecSet(
+          &posFather,
+          1,
+          stepYPrev *
+          ((float)(store->rank[firstPrev + father]) + 0.5));
+
+        // Create the curve bewteen the child and its parent
+        SCurve* curveBirth =
+          SCurveCreate(
+            3,
+            3,
+            1);
+        GSetPush(
+          &curves,
+          curveBirth);
+        SCurveSetCtrl(
+          curveBirth,
+          0,
+          (VecFloat*)&posNode);
+
+        VecSet(
+          &v,
+          0,
+          stepXEpoch * ((float)jEpoch));
+        VecSet(
+          &v,
+          1,
+          stepYEpoch * ((float)iRank + 0.5));
+
+        SCurveSetCtrl(
+          curveBirth,
+          1,
+          (VecFloat*)&v);
+
+        VecSet(
+          &v,
+          0,
+          stepXEpoch * ((float)jEpoch));
+        VecSet(
+          &v,
+          1,
+          VecGet(
+            &posFather,
+            1));
+        SCurveSetCtrl(
+          curveBirth,
+          2,
+          (VecFloat*)&v);
+
+        SCurveSetCtrl(
+          curveBirth,
+          3,
+          (VecFloat*)&posFather);
+
+        // Select the ink
+        GBInkSolid* inkCurve = inkBirth;
+        if (store->id[iNode] == store->id[firstPrev + father]) {
+
+          inkCurve = inkSurvive;
+
+        }
+
+        // Create the pod for this curve
+        pod =
+          GBAddSCurve(
+            gb,
+            curveBirth,
+            &eye,
+            &hand,
+            tool,
+            inkCurve,
+            layerBirth);
+
+      }
+
+    }
+
+    // Unused variable
+    (void)pod;
+
+  }
+
+  // Update the GenBrush
+  STATS_ADD(nbShapoid, GSetNbElem(&shapoids));
+  STATS_ADD(nbCurve, GSetNbElem(&curves));
+  StatsStartPhase("update");
+  GBUpdate(gb);
+  StatsStartPhase("save");
+
+  // Save the final pixels of the GenBrush, streamed row by row from
+  // the top of the image
+  int width = that->dimHistoryImg[0];
+  int height = that->dimHistoryImg[1];
+  const GBPixel* pixels = GBSurfaceFinalPixels(surf);
+  uint32_t* row =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint32_t) * (size_t)width);
+  ImgWriter* writer =
+    ImgWriterCreate(
+      that->pathHistoryImg,
+      width,
+      height,
+      that->formatHistoryImg,
+      that->nbThread);
+  bool ret = (writer != NULL);
+  for (
+    int iRow = height - 1;
+    iRow >= 0 && ret == true;
+    --iRow) {
+
+    const GBPixel* pixelsRow = pixels + (size_t)iRow * (size_t)width;
+    for (
+      int iCol = 0;
+      iCol < width;
+      ++iCol) {
+
+      row[iCol] =
+        RASTER_RGBA(
+          pixelsRow[iCol]._rgba[GBPixelRed],
+          pixelsRow[iCol]._rgba[GBPixelGreen],
+          pixelsRow[iCol]._rgba[GBPixelBlue],
+          pixelsRow[iCol]._rgba[GBPixelAlpha]);
+
+    }
+
+    ret =
+      ImgWriterAddRow(
+        writer,
+        row);
+
+  }
+
+  if (writer != NULL) {
+
+    ret = ImgWriterClose(writer) && ret;
+    ImgWriterFree(&writer);
+
+  }
+
+  free(row);
+  if (ret == true) {
+
+    printf(
+      "Saved image [%s]\n",
+      that->pathHistoryImg);
+
+  } else {
+
+    fprintf(
+      stderr,
+      "Couldn't save the image [%s]\n",
+      that->pathHistoryImg);
+
+  }
+
+  // Free memory
+  while (GSetNbElem(&curves) > 0) {
+
+    free(GSetPop(&curves));
+
+  }
+
+  while (GSetNbElem(&shapoids) > 0) {
+
+    free(GSetPop(&shapoids));
+
+  }
+
+  GBInkSolidFree(&inkEpoch);
+  GBInkSolidFree(&inkBirth);
+  GBInkSolidFree(&inkSurvive);
+  GBToolPlotterFree(&tool);
+  GBEyeOrthoFree(&eye);
+  GBFree(&gb);
+
+  // Return the success code
+  return ret;
+
+}
+
+
+// Create the image from the history by drawing directly into a Raster
+// Return true if successfull, else false
+bool GAViewerHistoryToImgDirect(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (that->pathHistoryImg == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that->pathHistory' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  StatsStartPhase("draw");
+
+  // Create the raster
+  int width = that->dimHistoryImg[0];
+  int height = that->dimHistoryImg[1];
+  Raster raster =
+    RasterCreateStatic(
+      width,
+      height);
+  RasterFill(
+    &raster,
+    RASTER_RGBA(255, 255, 255, 255));
+
+  // Draw the history, in tiles drawn in parallel if there are several
+  // threads
+  if (that->nbThread > 1) {
+
+    GAViewerDrawHistoryTiled(
+      that,
+      &raster);
+
+  } else {
+
+    GAViewerDrawHistory(
+      that,
+      &raster);
+
+  }
+
+  // Save the raster
+  StatsStartPhase("save");
+  bool ret =
+    RasterSave(
+      &raster,
+      that->pathHistoryImg,
+      that->formatHistoryImg,
+      that->nbThread);
+  if (ret == true) {
+
+    printf(
+      "Saved image [%s]\n",
+      that->pathHistoryImg);
+
+  } else {
+
+    fprintf(
+      stderr,
+      "Couldn't save the image [%s]\n",
+      that->pathHistoryImg);
+
+  }
+
+  // Free memory
+  RasterFree(&raster);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Create the image from the history by drawing it directly into
+// horizontal strips of pixels, from the top of the image, each strip
+// being added to the image file before the next one is drawn
+// Return true if successfull, else false
+bool GAViewerHistoryToImgStrips(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (that->pathHistoryImg == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that->pathHistory' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Create the writer of the image
+  int width = that->dimHistoryImg[0];
+  int height = that->dimHistoryImg[1];
+  ImgWriter* writer =
+    ImgWriterCreate(
+      that->pathHistoryImg,
+      width,
+      height,
+      that->formatHistoryImg,
+      that->nbThread);
+  if (writer == NULL) {
+
+    fprintf(
+      stderr,
+      "Couldn't save the image [%s]\n",
+      that->pathHistoryImg);
+    return false;
+
+  }
+
+  // Create the raster of the strips as a window of the image, as many
+  // rows as fit in RENDER_SIZESTRIP
+  int nbRowStrip =
+    (int)MIN(
+      MAX(
+        RENDER_SIZESTRIP / (4 * (size_t)width),
+        (size_t)1),
+      (size_t)height);
+  Raster raster =
+    RasterCreateStatic(
+      width,
+      nbRowStrip);
+  raster.widthImg = width;
+  raster.heightImg = height;
+
+  // Loop on the strips from the top of the image
+  bool ret = true;
+  for (
+    int yTop = height;
+    yTop > 0 && ret == true;
+    yTop -= nbRowStrip) {
+
+    // Move the window of the raster to the strip, and draw only the
+    // epochs and the ranks of nodes whose discs or edges cross it
+    StatsStartPhase("draw");
+    raster.height =
+      MIN(
+        nbRowStrip,
+        yTop);
+    raster.originY = yTop - raster.height;
+    raster.yMin = raster.originY;
+    raster.yMax = yTop - 1;
+    RasterFill(
+      &raster,
+      RASTER_RGBA(255, 255, 255, 255));
+    if (that->nbThread > 1) {
+
+      GAViewerDrawHistoryTiled(
+        that,
+        &raster);
+
+    } else {
+
+      GAViewerDrawHistory(
+        that,
+        &raster);
+
+    }
+
+    // Add the rows of the strip from its top
+    StatsStartPhase("save");
+    for (
+      int iRow = raster.height - 1;
+      iRow >= 0 && ret == true;
+      --iRow) {
+
+      ret =
+        ImgWriterAddRow(
+          writer,
+          raster.pixels + (size_t)iRow * (size_t)width);
+
+    }
+
+  }
+
+  // Close the image
+  ret = ImgWriterClose(writer) && ret;
+  ImgWriterFree(&writer);
+  if (ret == true) {
+
+    printf(
+      "Saved image [%s]\n",
+      that->pathHistoryImg);
+
+  } else {
+
+    fprintf(
+      stderr,
+      "Couldn't save the image [%s]\n",
+      that->pathHistoryImg);
+
+  }
+
+  // Free memory
+  RasterFree(&raster);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Create the image from the layout file of the out-of-core mode with
+// the direct renderer, reading one epoch at a time
+// Return true if successfull, else false
+bool GAViewerHistoryToImgOutOfCore(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (that->oocRuns == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that->oocRuns' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  StatsStartPhase("draw");
+
+  // Open the layout file and check its header
+  FILE* stream =
+    fopen(
+      that->oocRuns->pathLayout,
+      "rb");
+  if (stream == NULL) {
+
+    fprintf(
+      stderr,
+      "Couldn't open the layout [%s]\n",
+      that->oocRuns->pathLayout);
+    return false;
+
+  }
+
+  GaoHeader header;
+  bool ret =
+    fread(
+      &header,
+      sizeof(GaoHeader),
+      1,
+      stream) == 1 &&
+    memcmp(
+      header.magic,
+      GAO_MAGIC,
+      4) == 0 &&
+    header.version == GAO_VERSION;
+
+  // Create the raster
+  int width = that->dimHistoryImg[0];
+  int height = that->dimHistoryImg[1];
+  Raster raster =
+    RasterCreateStatic(
+      width,
+      height);
+  RasterFill(
+    &raster,
+    RASTER_RGBA(255, 255, 255, 255));
+
+  // Draw the epoch lines first as they are under the births
+  float stepXEpoch =
+    GAViewerGetStepXEpoch(
+      that,
+      &raster);
+  for (
+    unsigned long iEpoch = that->fromEpoch;
+    iEpoch <= that->toEpoch && iEpoch < that->nbEpoch;
+    ++iEpoch) {
+
+    unsigned long jEpoch = iEpoch - that->fromEpoch;
+    RasterDrawVLine(
+      &raster,
+      stepXEpoch * ((float)jEpoch + 0.5),
+      0.01 * (float)height,
+      0.99 * (float)height,
+      RASTER_RGBA(202, 202, 202, 255));
+
+  }
+
+  // Loop on the epochs of the layout, reading the nodes of one epoch at
+  // a time, the epoch before the first displayed one only giving the
+  // nb of nodes of the fathers
+  LodBuffer lod;
+  lod.counts = NULL;
+  GaoNode* nodes = NULL;
+  uint32_t nbNodeAlloc = 0;
+  uint32_t nbNodePrev = 0;
+  for (
+    uint64_t jEpoch = 0;
+    ret == true && jEpoch < header.nbEpoch;
+    ++jEpoch) {
+
+    // Read the nodes of the epoch
+    uint32_t nbNode = 0;
+    ret =
+      fread(
+        &nbNode,
+        sizeof(uint32_t),
+        1,
+        stream) == 1;
+    if (ret == true && nbNode > nbNodeAlloc) {
+
+      nbNodeAlloc = nbNode;
+      free(nodes);
+      nodes =
+        PBErrMalloc(
+          GAViewerErr,
+          sizeof(GaoNode) * nbNodeAlloc);
+
+    }
+
+    ret =
+      ret &&
+      fread(
+        nodes,
+        sizeof(GaoNode),
+        nbNode,
+        stream) == nbNode;
+
+    // Draw the epoch if it's displayed
+    unsigned long iEpoch = header.fromEpoch + jEpoch;
+    if (
+      ret == true &&
+      iEpoch >= that->fromEpoch &&
+      iEpoch <= that->toEpoch) {
+
+      GAViewerDrawEpochOutOfCore(
+        that,
+        &raster,
+        iEpoch,
+        nodes,
+        nbNode,
+        nbNodePrev,
+        &lod);
+
+    }
+
+    nbNodePrev = nbNode;
+
+  }
+
+  fclose(stream);
+  if (ret == false) {
+
+    fprintf(
+      stderr,
+      "Invalid layout [%s]\n",
+      that->oocRuns->pathLayout);
+
+  }
+
+  // Save the raster
+  if (ret == true) {
+
+    StatsStartPhase("save");
+    ret =
+      RasterSave(
+        &raster,
+        that->pathHistoryImg,
+        that->formatHistoryImg,
+        that->nbThread);
+    if (ret == true) {
+
+      printf(
+        "Saved image [%s]\n",
+        that->pathHistoryImg);
+
+    } else {
+
+      fprintf(
+        stderr,
+        "Couldn't save the image [%s]\n",
+        that->pathHistoryImg);
+
+    }
+
+  }
+
+  // Free memory
+  free(nodes);
+  LodBufferFree(&lod);
+  RasterFree(&raster);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Save the history of the GAViewer 'that' as a SVG image at 'path',
+// with the same layout as the direct renderer, the elements being
+// streamed to the file while the epochs are walked
+// Return true if successfull, else false
+bool GAViewerHistoryToSvg(
+  const GAViewer* const that,
+      const char* const path) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  StatsStartPhase("svg");
+
+  // Open the file
+  SvgWriter* writer = SvgWriterCreate(path);
+  if (writer == NULL) {
+
+    fprintf(
+      stderr,
+      "Couldn't open the image [%s]\n",
+      path);
+    return false;
+
+  }
+
+  // Write the header of the image, with the style of the elements: the
+  // epoch lines, the discs of the births drawn as the round caps of
+  // null segments, the edges of the births and of the survivors
+  int width = that->dimHistoryImg[0];
+  int height = that->dimHistoryImg[1];
+  char str[256];
+  sprintf(
+    str,
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" \
+    "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%d\" " \
+    "height=\"%d\" viewBox=\"0 0 %d %d\">\n",
+    width,
+    height,
+    width,
+    height);
+  SvgWriterAddStr(
+    writer,
+    str);
+  SvgWriterAddStr(
+    writer,
+    "<style>path{fill:none}.e{stroke:#cacaca}" \
+    ".d{stroke:#000;stroke-linecap:round}.b{stroke:#000}" \
+    ".s{stroke:#f00}</style>\n" \
+    "<rect width=\"100%\" height=\"100%\" fill=\"#fff\"/>\n");
+
+  // Calculate the step along x between two epochs, and the bottom and
+  // top of the epoch lines. The y axis of the layout goes up while the
+  // one of SVG goes down, so the y coordinates are flipped
+  float stepXEpoch =
+    (float)width /
+    (float)(that->toEpoch - that->fromEpoch + 1);
+  float yMinEpoch = 0.01 * (float)height;
+  float yMaxEpoch = 0.99 * (float)height;
+
+  // Loop on epochs
+  const NodeStore* store = &(that->nodes);
+  uint64_t nbDisc = 0;
+  for (
+    unsigned long iEpoch = that->fromEpoch;
+    iEpoch <= that->toEpoch && iEpoch < that->nbEpoch;
+    ++iEpoch) {
+
+    // Declare some parameters to calculate the position of the nodes
+    unsigned long jEpoch = iEpoch - that->fromEpoch;
+    uint64_t first = store->first[iEpoch];
+    uint32_t nbNode = store->first[iEpoch + 1] - first;
+    float stepYEpoch = (float)height / (float)nbNode;
+    float radiusCircle =
+      MIN(
+        stepYEpoch * 0.125,
+        stepXEpoch * 0.5);
+    float xNode = stepXEpoch * ((float)jEpoch + 0.5);
+
+    // Open the group of the epoch and add its line
+    sprintf(
+      str,
+      "<g id=\"epoch%lu\">\n<path class=\"e\" d=\"M",
+      iEpoch);
+    SvgWriterAddStr(
+      writer,
+      str);
+    SvgWriterAddNum(
+      writer,
+      xNode);
+    SvgWriterAddStr(
+      writer,
+      " ");
+    SvgWriterAddNum(
+      writer,
+      (float)height - yMinEpoch);
+    SvgWriterAddStr(
+      writer,
+      "V");
+    SvgWriterAddNum(
+      writer,
+      (float)height - yMaxEpoch);
+    SvgWriterAddStr(
+      writer,
+      "\"/>\n");
+
+    // Add the discs of the nodes, in one path whose width is their
+    // diameter
+    SvgWriterAddStr(
+      writer,
+      "<path class=\"d\" stroke-width=\"");
+    SvgWriterAddNum(
+      writer,
+      2.0 * radiusCircle);
+    SvgWriterAddStr(
+      writer,
+      "\" d=\"");
+    for (
+      uint32_t iRank = 0;
+      iRank < nbNode;
+      ++iRank) {
+
+      uint64_t iNode = first + store->order[first + iRank];
+      if (GAViewerIsTraced(that, iNode) == false) {
+
+        continue;
+
+      }
+
+      SvgWriterAddStr(
+        writer,
+        "M");
+      SvgWriterAddNum(
+        writer,
+        xNode);
+      SvgWriterAddStr(
+        writer,
+        " ");
+      SvgWriterAddNum(
+        writer,
+        (float)height - stepYEpoch * ((float)iRank + 0.5));
+      SvgWriterAddStr(
+        writer,
+        "h0");
+      ++nbDisc;
+
+    }
+
+    SvgWriterAddStr(
+      writer,
+      "\"/>\n");
+
+    // Add the edges of the births, then the ones of the survivors, and
+    // close the group of the epoch
+    if (jEpoch > 0) {
+
+      GAViewerSvgAddEdges(
+        that,
+        writer,
+        iEpoch,
+        false,
+        stepXEpoch,
+        height);
+      GAViewerSvgAddEdges(
+        that,
+        writer,
+        iEpoch,
+        true,
+        stepXEpoch,
+        height);
+
+    }
+
+    SvgWriterAddStr(
+      writer,
+      "</g>\n");
+
+  }
+
+  // Write the end of the image and close the file
+  SvgWriterAddStr(
+    writer,
+    "</svg>\n");
+  STATS_ADD(nbShapoid, nbDisc);
+  bool ret = SvgWriterClose(writer);
+  SvgWriterFree(&writer);
+  if (ret == true) {
+
+    printf(
+      "Saved image [%s]\n",
+      path);
+
+  } else {
+
+    fprintf(
+      stderr,
+      "Couldn't save the image [%s]\n",
+      path);
+
+  }
+
+  // Return the success code
+  return ret;
+
+}
+
+// Add to the SvgWriter 'writer' the path element holding the edges
+// of the ink 'isSurvive' (edges of survivors if true, else of births)
+// between the nodes of the epoch 'iEpoch' and their father, for the
+// image of 'height' pixels with 'stepXEpoch' pixels between two
+// epochs
+void GAViewerSvgAddEdges(
+  const GAViewer* const that,
+       SvgWriter* const writer,
+    const unsigned long iEpoch,
+             const bool isSurvive,
+            const float stepXEpoch,
+              const int height) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (writer == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'writer' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Declare some parameters to calculate the position of the nodes and
+  // of their father
+  const NodeStore* store = &(that->nodes);
+  unsigned long jEpoch = iEpoch - that->fromEpoch;
+  uint64_t first = store->first[iEpoch];
+  uint32_t nbNode = store->first[iEpoch + 1] - first;
+  uint64_t firstPrev = store->first[iEpoch - 1];
+  float stepYEpoch = (float)height / (float)nbNode;
+  float stepYPrev = (float)height / (float)(first - firstPrev);
+  float xNode = stepXEpoch * ((float)jEpoch + 0.5);
+  float xCtrl = stepXEpoch * (float)jEpoch;
+  float xFather = stepXEpoch * ((float)jEpoch - 0.5);
+
+  // Loop on the nodes in their rank order, the path element being
+  // opened at the first edge of the ink so there is none if the epoch
+  // has no such edge
+  bool isOpen = false;
+  uint64_t nbEdge = 0;
+  for (
+    uint32_t iRank = 0;
+    iRank < nbNode;
+    ++iRank) {
+
+    // Skip the nodes without father, not in the traced lineage or
+    // whose edge has the other ink
+    uint64_t iNode = first + store->order[first + iRank];
+    uint32_t father = store->fatherIdx[iNode];
+    if (
+      father == NODE_NONE ||
+      GAViewerIsTraced(that, iNode) == false ||
+      (store->id[iNode] == store->id[firstPrev + father]) != isSurvive) {
+
+      continue;
+
+    }
+
+    if (isOpen == false) {
+
+      SvgWriterAddStr(
+        writer,
+        (isSurvive == true ?
+          "<path class=\"s\" d=\"" :
+          "<path class=\"b\" d=\""));
+      isOpen = true;
+
+    }
+
+    // Add the Bezier curve between the node and its father, with the
+    // same control points as the direct renderer
+    float yNode =
+      (float)height - stepYEpoch * ((float)iRank + 0.5);
+    float yFather =
+      (float)height -
+      stepYPrev * ((float)(store->rank[firstPrev + father]) + 0.5);
+    SvgWriterAddStr(
+      writer,
+      "M");
+    SvgWriterAddNum(
+      writer,
+      xNode);
+    SvgWriterAddStr(
+      writer,
+      " ");
+    SvgWriterAddNum(
+      writer,
+      yNode);
+    SvgWriterAddStr(
+      writer,
+      "C");
+    SvgWriterAddNum(
+      writer,
+      xCtrl);
+    SvgWriterAddStr(
+      writer,
+      " ");
+    SvgWriterAddNum(
+      writer,
+      yNode);
+    SvgWriterAddStr(
+      writer,
+      " ");
+    SvgWriterAddNum(
+      writer,
+      xCtrl);
+    SvgWriterAddStr(
+      writer,
+      " ");
+    SvgWriterAddNum(
+      writer,
+      yFather);
+    SvgWriterAddStr(
+      writer,
+      " ");
+    SvgWriterAddNum(
+      writer,
+      xFather);
+    SvgWriterAddStr(
+      writer,
+      " ");
+    SvgWriterAddNum(
+      writer,
+      yFather);
+    ++nbEdge;
+
+  }
+
+  if (isOpen == true) {
+
+    SvgWriterAddStr(
+      writer,
+      "\"/>\n");
+
+  }
+
+  STATS_ADD(nbCurve, nbEdge);
+
+}
+
+// Save at 'path' the statistics of each displayed epoch of the history
+// of the GAViewer 'that' as CSV: its nb of nodes, births and survivors,
+// the nb of distinct fathers of its births, the distribution of the nb
+// of births per node of the previous epoch, and the nb of lineages of
+// the first ranked epoch it still holds
+// Return true if successfull, else false
+bool GAViewerHistoryToStatsCsv(
+  const GAViewer* const that,
+      const char* const path) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  StatsStartPhase("csv");
+
+  // Open the file and write the header
+  FILE* stream =
+    fopen(
+      path,
+      "w");
+  if (stream == NULL) {
+
+    fprintf(
+      stderr,
+      "Couldn't open the statistics file [%s]\n",
+      path);
+    return false;
+
+  }
+
+  fprintf(
+    stream,
+    "epoch,nbNode,nbBirth,nbSurvivor,nbFather");
+  for (
+    int iCount = 0;
+    iCount < STATSCSV_NBOFFSPRING;
+    ++iCount) {
+
+    fprintf(
+      stream,
+      ",offspring%d%s",
+      iCount,
+      (iCount == STATSCSV_NBOFFSPRING - 1 ? "+" : ""));
+
+  }
+
+  fprintf(
+    stream,
+    ",offspringMax,nbLineage\n");
+
+  // Get the range of ranked epochs, whose fathers have been searched,
+  // the nodes of the first one being the founders of the lineages
+  const NodeStore* store = &(that->nodes);
+  unsigned long firstEpoch = (that->fromEpoch > 0 ? that->fromEpoch - 1 : 0);
+  unsigned long toEpoch =
+    MIN(
+      that->toEpoch,
+      that->nbEpoch - 1);
+  uint64_t nbNodeMax = 0;
+  for (
+    unsigned long iEpoch = firstEpoch;
+    iEpoch <= toEpoch && iEpoch < that->nbEpoch;
+    ++iEpoch) {
+
+    nbNodeMax =
+      MAX(
+        nbNodeMax,
+        store->first[iEpoch + 1] - store->first[iEpoch]);
+
+  }
+
+  // Allocate the lineage of the nodes of the current and previous
+  // epochs, the nb of births of each node of the previous epoch, and
+  // the last epoch each lineage has been counted at
+  uint32_t* lineages[2];
+  for (
+    int iBuf = 0;
+    iBuf < 2;
+    ++iBuf) {
+
+    lineages[iBuf] =
+      PBErrMalloc(
+        GAViewerErr,
+        sizeof(uint32_t) * MAX(nbNodeMax, 1));
+
+  }
+
+  uint32_t* nbOffspring =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint32_t) * MAX(nbNodeMax, 1));
+  uint32_t* lastEpochs = NULL;
+
+  // Loop on the ranked epochs, in one pass over the columns of their
+  // nodes
+  for (
+    unsigned long iEpoch = firstEpoch;
+    iEpoch <= toEpoch && iEpoch < that->nbEpoch;
+    ++iEpoch) {
+
+    uint64_t first = store->first[iEpoch];
+    uint32_t nbNode = store->first[iEpoch + 1] - first;
+    uint32_t* lineage = lineages[(iEpoch - firstEpoch) & 1];
+    const uint32_t* lineagePrev = lineages[(iEpoch - firstEpoch + 1) & 1];
+    uint32_t nbSurvivor = 0;
+    uint32_t nbFather = 0;
+    uint32_t offspringMax = 0;
+    uint32_t counts[STATSCSV_NBOFFSPRING] = {0};
+
+    // The nodes of the first ranked epoch are the founders of their
+    // own lineage
+    if (iEpoch == firstEpoch) {
+
+      for (
+        uint32_t iNode = 0;
+        iNode < nbNode;
+        ++iNode) {
+
+        lineage[iNode] = iNode;
+
+      }
+
+      lastEpochs =
+        PBErrMalloc(
+          GAViewerErr,
+          sizeof(uint32_t) * MAX(nbNode, 1));
+      for (
+        uint32_t iNode = 0;
+        iNode < nbNode;
+        ++iNode) {
+
+        lastEpochs[iNode] = UINT32_MAX;
+
+      }
+
+    // Else, the nodes inherit the lineage of their father, and the
+    // births are counted per father
+    } else {
+
+      uint64_t firstPrev = store->first[iEpoch - 1];
+      uint32_t nbNodePrev = first - firstPrev;
+      memset(
+        nbOffspring,
+        0,
+        sizeof(uint32_t) * nbNodePrev);
+      for (
+        uint32_t iNode = 0;
+        iNode < nbNode;
+        ++iNode) {
+
+        uint32_t father = store->fatherIdx[first + iNode];
+        if (father == NODE_NONE) {
+
+          lineage[iNode] = NODE_NONE;
+          continue;
+
+        }
+
+        lineage[iNode] = lineagePrev[father];
+        if (store->id[first + iNode] == store->id[firstPrev + father]) {
+
+          ++nbSurvivor;
+
+        } else {
+
+          ++(nbOffspring[father]);
+
+        }
+
+      }
+
+      // Get the distribution of the nb of births per node of the
+      // previous epoch
+      for (
+        uint32_t iNode = 0;
+        iNode < nbNodePrev;
+        ++iNode) {
+
+        uint32_t nb = nbOffspring[iNode];
+        nbFather += (nb > 0);
+        offspringMax =
+          MAX(
+            offspringMax,
+            nb);
+        ++(counts[MIN(nb, STATSCSV_NBOFFSPRING - 1)]);
+
+      }
+
+    }
+
+    // The epoch before the first displayed one only gives the founders
+    // and the fathers
+    if (iEpoch < that->fromEpoch) {
+
+      continue;
+
+    }
+
+    // Count the lineages still held by the nodes of the epoch
+    uint32_t nbLineage = 0;
+    for (
+      uint32_t iNode = 0;
+      iNode < nbNode;
+      ++iNode) {
+
+      uint32_t founder = lineage[iNode];
+      if (
+        founder != NODE_NONE &&
+        lastEpochs[founder] != (uint32_t)iEpoch) {
+
+        lastEpochs[founder] = iEpoch;
+        ++nbLineage;
+
+      }
+
+    }
+
+    // Write the statistics of the epoch
+    fprintf(
+      stream,
+      "%lu,%u,%u,%u,%u",
+      iEpoch,
+      nbNode,
+      nbNode - nbSurvivor,
+      nbSurvivor,
+      nbFather);
+    for (
+      int iCount = 0;
+      iCount < STATSCSV_NBOFFSPRING;
+      ++iCount) {
+
+      fprintf(
+        stream,
+        ",%u",
+        counts[iCount]);
+
+    }
+
+    fprintf(
+      stream,
+      ",%u,%u\n",
+      offspringMax,
+      nbLineage);
+
+  }
+
+  // Close the file
+  bool ret = (fclose(stream) == 0);
+  if (ret == true) {
+
+    printf(
+      "Saved statistics [%s]\n",
+      path);
+
+  } else {
+
+    fprintf(
+      stderr,
+      "Couldn't write the statistics file [%s]\n",
+      path);
+
+  }
+
+  // Free memory
+  free(lineages[0]);
+  free(lineages[1]);
+  free(nbOffspring);
+  free(lastEpochs);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Display the history of the GAViewer 'that' in an interactive window,
+// where the view is dragged with the left button, zoomed with the
+// wheel (only along x with Shift, only along y with Ctrl), and the
+// hovered node is described below it
+// Return true if successfull, else false
+bool GAViewerShowWindow(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+#if BUILDWITHGRAPHICLIB
+  StatsStartPhase("window");
+
+  // Init GTK
+  bool ret =
+    gtk_init_check(
+      NULL,
+      NULL);
+  if (ret == false) {
+
+    fprintf(
+      stderr,
+      "Couldn't open the display\n");
+    return false;
+
+  }
+
+  // The history is drawn by the direct renderer, drawing one epoch per
+  // column of pixels so the cost of a view depends on its size rather
+  // than on the nb of epochs
+  that->isOneEpochPerColumn = true;
+
+  // Init the window, the whole history fitting in it
+  GAViewerWindow win;
+  win.viewer = that;
+  win.zoomX = 1.0;
+  win.zoomY = 1.0;
+  win.originX = 0.0;
+  win.originY = 0.0;
+  win.raster.pixels = NULL;
+  win.surface = NULL;
+  win.isDirty = true;
+  win.isDragged = false;
+  win.dragX = 0.0;
+  win.dragY = 0.0;
+  win.isHovered = false;
+  win.hoverEpoch = 0;
+  win.hoverNode = 0;
+  win.timeDraw = 0.0;
+
+  // Create the widgets: the drawing area above the label describing
+  // the hovered node
+  win.window = gtk_window_new(GTK_WINDOW_TOPLEVEL);
+  gtk_window_set_title(
+    GTK_WINDOW(win.window),
+    that->pathHistory);
+  gtk_window_set_default_size(
+    GTK_WINDOW(win.window),
+    that->dimHistoryImg[0],
+    that->dimHistoryImg[1]);
+  GtkWidget* box =
+    gtk_box_new(
+      GTK_ORIENTATION_VERTICAL,
+      0);
+  gtk_container_add(
+    GTK_CONTAINER(win.window),
+    box);
+  win.area = gtk_drawing_area_new();
+  gtk_widget_set_can_focus(
+    win.area,
+    TRUE);
+  gtk_widget_add_events(
+    win.area,
+    GDK_BUTTON_PRESS_MASK |
+    GDK_BUTTON_RELEASE_MASK |
+    GDK_POINTER_MOTION_MASK |
+    GDK_SCROLL_MASK |
+    GDK_KEY_PRESS_MASK);
+  gtk_box_pack_start(
+    GTK_BOX(box),
+    win.area,
+    TRUE,
+    TRUE,
+    0);
+  win.label = gtk_label_new("");
+  gtk_label_set_xalign(
+    GTK_LABEL(win.label),
+    0.0);
+  gtk_box_pack_start(
+    GTK_BOX(box),
+    win.label,
+    FALSE,
+    FALSE,
+    2);
+
+  // Connect the callbacks
+  g_signal_connect(
+    win.window,
+    "destroy",
+    G_CALLBACK(gtk_main_quit),
+    NULL);
+  g_signal_connect(
+    win.area,
+    "draw",
+    G_CALLBACK(GAViewerWindowOnDraw),
+    &win);
+  g_signal_connect(
+    win.area,
+    "scroll-event",
+    G_CALLBACK(GAViewerWindowOnScroll),
+    &win);
+  g_signal_connect(
+    win.area,
+    "button-press-event",
+    G_CALLBACK(GAViewerWindowOnButton),
+    &win);
+  g_signal_connect(
+    win.area,
+    "button-release-event",
+    G_CALLBACK(GAViewerWindowOnButton),
+    &win);
+  g_signal_connect(
+    win.area,
+    "motion-notify-event",
+    G_CALLBACK(GAViewerWindowOnMotion),
+    &win);
+  g_signal_connect(
+    win.area,
+    "key-press-event",
+    G_CALLBACK(GAViewerWindowOnKey),
+    &win);
+
+  // Show the window and run the main loop until it's closed
+  gtk_widget_show_all(win.window);
+  gtk_widget_grab_focus(win.area);
+  gtk_main();
+
+  // Free memory
+  if (win.surface != NULL) {
+
+    cairo_surface_destroy(win.surface);
+
+  }
+
+  if (win.raster.pixels != NULL) {
+
+    RasterFree(&(win.raster));
+
+  }
+
+  that->isOneEpochPerColumn = false;
+
+  // Return the success code
+  return true;
+#else
+  (void)that;
+  fprintf(
+    stderr,
+    "The window is not available, gaviewer was built without the " \
+    "graphic library\n");
+  return false;
+#endif
+
+}
+
+// Pick the node of the GAViewer 'that' laid out in an image of
+// 'widthImg' x 'heightImg' pixels at the position 'x', 'y' of this
+// image. The epochs are evenly spaced columns and the nodes of an
+// epoch evenly spaced rows, so the layout is its own spatial index:
+// the epoch and the rank of the nearest node are calculated from the
+// position. The node is picked if it's drawn and its disc is within
+// 'distMax' pixels of the position, in which case its epoch and index
+// are returned in 'iEpoch' and 'iNode'
+// Return true if a node is picked, else false
+bool GAViewerPickNode(
+  const GAViewer* const that,
+              const int widthImg,
+              const int heightImg,
+            const float x,
+            const float y,
+            const float distMax,
+    unsigned long* const iEpoch,
+         uint64_t* const iNode) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (
+    iEpoch == NULL ||
+    iNode == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'iEpoch' or 'iNode' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Get the epoch of the column under the position, or the last epoch
+  // of this column if only the last epoch of each column is drawn
+  float stepXEpoch =
+    (float)widthImg /
+    (float)(that->toEpoch - that->fromEpoch + 1);
+  if (
+    x < 0.0f ||
+    y < 0.0f ||
+    y >= (float)heightImg) {
+
+    return false;
+
+  }
+
+  unsigned long epoch = that->fromEpoch + (unsigned long)(x / stepXEpoch);
+  if (
+    epoch > that->toEpoch ||
+    epoch >= that->nbEpoch) {
+
+    return false;
+
+  }
+
+  while (
+    GAViewerIsEpochCovered(
+      that,
+      stepXEpoch,
+      epoch) == true) {
+
+    ++epoch;
+
+  }
+
+  // Get the rank of the row of nodes under the position
+  const NodeStore* store = &(that->nodes);
+  uint64_t first = store->first[epoch];
+  uint32_t nbNode = store->first[epoch + 1] - first;
+  if (nbNode == 0) {
+
+    return false;
+
+  }
+
+  float stepYEpoch = (float)heightImg / (float)nbNode;
+  uint32_t rank =
+    MIN(
+      (uint32_t)(y / stepYEpoch),
+      nbNode - 1);
+
+  // Check the distance to the disc of the node, as for the direct
+  // renderer
+  unsigned long jEpoch = epoch - that->fromEpoch;
+  float radiusCircle =
+    MIN(
+      stepYEpoch * 0.125,
+      stepXEpoch * 0.5);
+  float dist =
+    MAX(
+      distMax,
+      radiusCircle);
+  float xNode = stepXEpoch * ((float)jEpoch + 0.5);
+  float yNode = stepYEpoch * ((float)rank + 0.5);
+  if (
+    fabsf(x - xNode) > dist ||
+    fabsf(y - yNode) > dist) {
+
+    return false;
+
+  }
+
+  // Pick the node if it's drawn
+  uint64_t node = first + store->order[first + rank];
+  if (GAViewerIsTraced(that, node) == false) {
+
+    return false;
+
+  }
+
+  *iEpoch = epoch;
+  *iNode = node;
+  return true;
+
+}
+
+#if BUILDWITHGRAPHICLIB
+// Callback drawing the view of the GAViewerWindow 'data' in the
+// drawing area 'widget' with the cairo context 'cr'
+gboolean GAViewerWindowOnDraw(
+   GtkWidget* widget,
+     cairo_t* cr,
+    gpointer data) {
+
+  GAViewerWindow* that = data;
+  int width = gtk_widget_get_allocated_width(widget);
+  int height = gtk_widget_get_allocated_height(widget);
+  if (
+    width <= 0 ||
+    height <= 0) {
+
+    return FALSE;
+
+  }
+
+  // If the size of the window has changed, allocate the raster and the
+  // surface again
+  if (
+    that->raster.pixels == NULL ||
+    that->raster.width != width ||
+    that->raster.height != height) {
+
+    if (that->raster.pixels != NULL) {
+
+      RasterFree(&(that->raster));
+      cairo_surface_destroy(that->surface);
+
+    }
+
+    that->raster =
+      RasterCreateStatic(
+        width,
+        height);
+    that->surface =
+      cairo_image_surface_create(
+        CAIRO_FORMAT_RGB24,
+        width,
+        height);
+    GAViewerWindowUpdateView(that);
+
+  }
+
+  // If the view has changed, draw it in the raster as the window of
+  // the virtual image, and copy it in the surface, whose rows go from
+  // the top
+  if (that->isDirty == true) {
+
+    double start = GAViewerGetTime();
+    Raster* raster = &(that->raster);
+    raster->widthImg = (int)round((double)width * that->zoomX);
+    raster->heightImg = (int)round((double)height * that->zoomY);
+    raster->originX = (int)round(that->originX);
+    raster->originY = (int)round(that->originY);
+    raster->xMin = raster->originX;
+    raster->xMax = raster->originX + width - 1;
+    raster->yMin = raster->originY;
+    raster->yMax = raster->originY + height - 1;
+    RasterFill(
+      raster,
+      RASTER_RGBA(255, 255, 255, 255));
+    GAViewerDrawHistory(
+      that->viewer,
+      raster);
+    cairo_surface_flush(that->surface);
+    unsigned char* pixels = cairo_image_surface_get_data(that->surface);
+    int stride = cairo_image_surface_get_stride(that->surface);
+    for (
+      int iRow = 0;
+      iRow < height;
+      ++iRow) {
+
+      memcpy(
+        pixels + (size_t)iRow * (size_t)stride,
+        raster->pixels + (size_t)(height - 1 - iRow) * (size_t)width,
+        sizeof(uint32_t) * (size_t)width);
+
+    }
+
+    cairo_surface_mark_dirty(that->surface);
+    that->isDirty = false;
+    that->timeDraw = GAViewerGetTime() - start;
+    GAViewerWindowUpdateLabel(that);
+
+  }
+
+  // Display the surface
+  cairo_set_source_surface(
+    cr,
+    that->surface,
+    0.0,
+    0.0);
+  cairo_paint(cr);
+
+  // Circle the hovered node
+  if (that->isHovered == true) {
+
+    const GAViewer* viewer = that->viewer;
+    const NodeStore* store = &(viewer->nodes);
+    float stepXEpoch =
+      (float)(that->raster.widthImg) /
+      (float)(viewer->toEpoch - viewer->fromEpoch + 1);
+    uint64_t first = store->first[that->hoverEpoch];
+    uint32_t nbNode = store->first[that->hoverEpoch + 1] - first;
+    float stepYEpoch = (float)(that->raster.heightImg) / (float)nbNode;
+    uint32_t rank = store->rank[that->hoverNode];
+    double x =
+      stepXEpoch * ((float)(that->hoverEpoch - viewer->fromEpoch) + 0.5) -
+      (float)(that->raster.originX);
+    double y =
+      (double)height -
+      (stepYEpoch * ((float)rank + 0.5) - (float)(that->raster.originY));
+    cairo_set_source_rgb(
+      cr,
+      0.0,
+      0.4,
+      1.0);
+    cairo_set_line_width(
+      cr,
+      2.0);
+    cairo_arc(
+      cr,
+      x,
+      y,
+      MAX(
+        WINDOW_PICKDIST,
+        stepYEpoch * 0.125 + 2.0),
+      0.0,
+      2.0 * M_PI);
+    cairo_stroke(cr);
+
+  }
+
+  return TRUE;
+
+}
+
+// Callback zooming the view of the GAViewerWindow 'data' around the
+// pointer
+gboolean GAViewerWindowOnScroll(
+       GtkWidget* widget,
+  GdkEventScroll* event,
+         gpointer data) {
+
+  (void)widget;
+  GAViewerWindow* that = data;
+  double factor = 0.0;
+  if (event->direction == GDK_SCROLL_UP) {
+
+    factor = WINDOW_ZOOMSTEP;
+
+  } else if (event->direction == GDK_SCROLL_DOWN) {
+
+    factor = 1.0 / WINDOW_ZOOMSTEP;
+
+  } else {
+
+    return FALSE;
+
+  }
+
+  // Shift zooms only along x, and Ctrl only along y
+  double factorX = factor;
+  double factorY = factor;
+  if ((event->state & GDK_SHIFT_MASK) != 0) {
+
+    factorY = 1.0;
+
+  } else if ((event->state & GDK_CONTROL_MASK) != 0) {
+
+    factorX = 1.0;
+
+  }
+
+  GAViewerWindowZoom(
+    that,
+    factorX,
+    factorY,
+    event->x,
+    event->y);
+  return TRUE;
+
+}
+
+// Callback starting and ending the drag of the view of the
+// GAViewerWindow 'data'
+gboolean GAViewerWindowOnButton(
+       GtkWidget* widget,
+  GdkEventButton* event,
+         gpointer data) {
+
+  GAViewerWindow* that = data;
+  if (event->button != 1) {
+
+    return FALSE;
+
+  }
+
+  gtk_widget_grab_focus(widget);
+  that->isDragged = (event->type == GDK_BUTTON_PRESS);
+  that->dragX = event->x;
+  that->dragY = event->y;
+  return TRUE;
+
+}
+
+// Callback dragging the view of the GAViewerWindow 'data', or picking
+// the node under the pointer
+gboolean GAViewerWindowOnMotion(
+       GtkWidget* widget,
+  GdkEventMotion* event,
+         gpointer data) {
+
+  GAViewerWindow* that = data;
+
+  // If the view is dragged, move it with the pointer, the y axis of the
+  // virtual image going up
+  if (that->isDragged == true) {
+
+    that->originX -= event->x - that->dragX;
+    that->originY += event->y - that->dragY;
+    that->dragX = event->x;
+    that->dragY = event->y;
+    GAViewerWindowUpdateView(that);
+    return TRUE;
+
+  }
+
+  // Else pick the node under the pointer, and display it if it has
+  // changed
+  if (that->raster.pixels == NULL) {
+
+    return FALSE;
+
+  }
+
+  unsigned long iEpoch = 0;
+  uint64_t iNode = 0;
+  int height = gtk_widget_get_allocated_height(widget);
+  bool isHovered =
+    GAViewerPickNode(
+      that->viewer,
+      that->raster.widthImg,
+      that->raster.heightImg,
+      (float)((double)(that->raster.originX) + event->x),
+      (float)((double)(that->raster.originY + height) - event->y),
+      WINDOW_PICKDIST,
+      &iEpoch,
+      &iNode);
+  if (
+    isHovered != that->isHovered ||
+    (isHovered == true && iNode != that->hoverNode)) {
+
+    that->isHovered = isHovered;
+    that->hoverEpoch = iEpoch;
+    that->hoverNode = iNode;
+    GAViewerWindowUpdateLabel(that);
+    gtk_widget_queue_draw(widget);
+
+  }
+
+  return TRUE;
+
+}
+
+// Callback of the keys of the GAViewerWindow 'data': Home or 0 to
+// reset the view, + and - to zoom around the center, q or Escape to
+// quit
+gboolean GAViewerWindowOnKey(
+    GtkWidget* widget,
+  GdkEventKey* event,
+      gpointer data) {
+
+  GAViewerWindow* that = data;
+  double x = 0.5 * (double)gtk_widget_get_allocated_width(widget);
+  double y = 0.5 * (double)gtk_widget_get_allocated_height(widget);
+  switch (event->keyval) {
+
+    case GDK_KEY_Home:
+    case GDK_KEY_0:
+      that->zoomX = 1.0;
+      that->zoomY = 1.0;
+      that->originX = 0.0;
+      that->originY = 0.0;
+      GAViewerWindowUpdateView(that);
+      break;
+
+    case GDK_KEY_plus:
+    case GDK_KEY_equal:
+    case GDK_KEY_KP_Add:
+      GAViewerWindowZoom(
+        that,
+        WINDOW_ZOOMSTEP,
+        WINDOW_ZOOMSTEP,
+        x,
+        y);
+      break;
+
+    case GDK_KEY_minus:
+    case GDK_KEY_KP_Subtract:
+      GAViewerWindowZoom(
+        that,
+        1.0 / WINDOW_ZOOMSTEP,
+        1.0 / WINDOW_ZOOMSTEP,
+        x,
+        y);
+      break;
+
+    case GDK_KEY_q:
+    case GDK_KEY_Escape:
+      gtk_widget_destroy(that->window);
+      break;
+
+    default:
+      return FALSE;
+
+  }
+
+  return TRUE;
+
+}
+
+// Multiply the zoom of the GAViewerWindow 'that' by 'factorX' and
+// 'factorY', keeping the point of the virtual image under the position
+// 'x', 'y' of the window at the same place
+void GAViewerWindowZoom(
+  GAViewerWindow* const that,
+     const double factorX,
+     const double factorY,
+           const double x,
+           const double y) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Get the position under the pointer relative to the virtual image,
+  // the y axis of the image going up
+  double width = (double)gtk_widget_get_allocated_width(that->area);
+  double height = (double)gtk_widget_get_allocated_height(that->area);
+  double relX = (that->originX + x) / (width * that->zoomX);
+  double relY = (that->originY + height - y) / (height * that->zoomY);
+
+  // Update the zoom, clamped to the max size of the virtual image
+  that->zoomX =
+    MIN(
+      MAX(
+        that->zoomX * factorX,
+        1.0),
+      (double)WINDOW_SIZEIMGMAX / width);
+  that->zoomY =
+    MIN(
+      MAX(
+        that->zoomY * factorY,
+        1.0),
+      (double)WINDOW_SIZEIMGMAX / height);
+
+  // Move the view to keep the same position under the pointer
+  that->originX = relX * width * that->zoomX - x;
+  that->originY = relY * height * that->zoomY - (height - y);
+  GAViewerWindowUpdateView(that);
+
+}
+
+// Clamp the zoom and the position of the view of the GAViewerWindow
+// 'that' to the virtual image, and request to draw the view again
+void GAViewerWindowUpdateView(GAViewerWindow* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  double width = (double)gtk_widget_get_allocated_width(that->area);
+  double height = (double)gtk_widget_get_allocated_height(that->area);
+  that->originX =
+    MIN(
+      MAX(
+        that->originX,
+        0.0),
+      width * (that->zoomX - 1.0));
+  that->originY =
+    MIN(
+      MAX(
+        that->originY,
+        0.0),
+      height * (that->zoomY - 1.0));
+  that->isDirty = true;
+  gtk_widget_queue_draw(that->area);
+
+}
+
+// Update the text describing the hovered node and the view below the
+// view of the GAViewerWindow 'that'
+void GAViewerWindowUpdateLabel(GAViewerWindow* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Describe the hovered node: its id, epoch, rank and parents, and if
+  // it's a survivor
+  char str[256];
+  int len = 0;
+  if (that->isHovered == true) {
+
+    const NodeStore* store = &(that->viewer->nodes);
+    uint64_t iNode = that->hoverNode;
+    uint32_t father = store->fatherIdx[iNode];
+    bool isSurvive =
+      father != NODE_NONE &&
+      store->id[iNode] == store->id[store->first[that->hoverEpoch - 1] + father];
+    len =
+      sprintf(
+        str,
+        "id %u at epoch %lu (rank %u), father %u, mother %u%s | ",
+        store->id[iNode],
+        that->hoverEpoch,
+        store->rank[iNode],
+        store->father[iNode],
+        store->mother[iNode],
+        (isSurvive == true ? ", survivor" : ""));
+
+  }
+
+  // Describe the view
+  sprintf(
+    str + len,
+    "zoom %.2f x %.2f, drawn in %.1fms",
+    that->zoomX,
+    that->zoomY,
+    that->timeDraw * 1e3);
+  gtk_label_set_text(
+    GTK_LABEL(that->label),
+    str);
+
+}
+#endif
+
+// Follow the history of the GAViewer 'that': draw its image, then
+// watch its file and, each time it has grown and at most every
+// 'that->followInterval' seconds, load the appended births, rank the
+// new epochs and redraw the columns from the first changed epoch,
+// until SIGINT or SIGTERM
+// Return true if successfull, else false
+bool GAViewerFollow(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // The follow mode updates the image of a JSON history
+  if (that->pathHistoryImg == NULL) {
+
+    fprintf(
+      stderr,
+      "-follow requires -toImg\n");
+    return false;
+
+  }
+
+  if (
+    that->pathHistory == NULL ||
+    that->pathHistoryBin != NULL ||
+    that->nodes.map != NULL) {
+
+    fprintf(
+      stderr,
+      "-follow requires a JSON history without -toBin\n");
+    return false;
+
+  }
+
+  // Watch the directory of the history rather than the file itself,
+  // so the history is still followed if it's replaced by a new file
+  const char* posSlash =
+    strrchr(
+      that->pathHistory,
+      '/');
+  const char* nameHistory =
+    (posSlash != NULL ? posSlash + 1 : that->pathHistory);
+  char* pathDir = strdup(posSlash != NULL ? that->pathHistory : ".");
+  if (posSlash != NULL) {
+
+    pathDir[
+      MAX(
+        posSlash - that->pathHistory,
+        1)] = '\0';
+
+  }
+
+  int fd =
+    inotify_init1(
+      IN_NONBLOCK |
+      IN_CLOEXEC);
+  int wd = -1;
+  if (fd >= 0) {
+
+    wd =
+      inotify_add_watch(
+        fd,
+        pathDir,
+        IN_MODIFY |
+        IN_CLOSE_WRITE |
+        IN_MOVED_TO |
+        IN_CREATE);
+
+  }
+
+  if (wd < 0) {
+
+    fprintf(
+      stderr,
+      "Couldn't watch the directory [%s]: %s\n",
+      pathDir,
+      strerror(errno));
+    if (fd >= 0) {
+
+      close(fd);
+
+    }
+
+    free(pathDir);
+    return false;
+
+  }
+
+  // Stop following on SIGINT and SIGTERM, which interrupt the wait for
+  // the next change
+  struct sigaction action;
+  memset(
+    &action,
+    0,
+    sizeof(action));
+  action.sa_handler = GAViewerFollowStop;
+  sigemptyset(&(action.sa_mask));
+  sigaction(
+    SIGINT,
+    &action,
+    NULL);
+  sigaction(
+    SIGTERM,
+    &action,
+    NULL);
+
+  // Draw the image of the history already loaded, the raster being kept
+  // to redraw only the changed columns
+  int width = that->dimHistoryImg[0];
+  int height = that->dimHistoryImg[1];
+  Raster raster =
+    RasterCreateStatic(
+      width,
+      height);
+  RasterFill(
+    &raster,
+    RASTER_RGBA(255, 255, 255, 255));
+  that->toEpoch = that->fromEpoch;
+  GAViewerFollowLayout(that);
+  bool ret =
+    GAViewerFollowDraw(
+      that,
+      &raster,
+      that->fromEpoch);
+  struct timespec timeUpdate;
+  clock_gettime(
+    CLOCK_MONOTONIC,
+    &timeUpdate);
+
+  // The history may have changed before it was watched
+  bool isChanged = true;
+
+  // Loop until stopped
+  char events[4096]
+    __attribute__ ((aligned(__alignof__(struct inotify_event))));
+  while (
+    ret == true &&
+    followIsStopped == 0) {
+
+    // Get the time elapsed since the last update
+    struct timespec timeNow;
+    clock_gettime(
+      CLOCK_MONOTONIC,
+      &timeNow);
+    double elapsed =
+      (double)(timeNow.tv_sec - timeUpdate.tv_sec) +
+      (double)(timeNow.tv_nsec - timeUpdate.tv_nsec) * 1e-9;
+
+    // If the history has changed and the interval since the last
+    // update has elapsed, update the image
+    if (
+      isChanged == true &&
+      elapsed >= that->followInterval) {
+
+      isChanged = false;
+      ret =
+        GAViewerFollowUpdate(
+          that,
+          &raster);
+      clock_gettime(
+        CLOCK_MONOTONIC,
+        &timeUpdate);
+      continue;
+
+    }
+
+    // Wait for the next change, or for the end of the interval if the
+    // history has already changed
+    int timeout = -1;
+    if (isChanged == true) {
+
+      timeout = (int)((that->followInterval - elapsed) * 1000.0) + 1;
+
+    }
+
+    struct pollfd pollFd;
+    pollFd.fd = fd;
+    pollFd.events = POLLIN;
+    pollFd.revents = 0;
+    int nbReady =
+      poll(
+        &pollFd,
+        1,
+        timeout);
+    if (
+      nbReady < 0 &&
+      errno != EINTR) {
+
+      fprintf(
+        stderr,
+        "Couldn't watch the history: %s\n",
+        strerror(errno));
+      ret = false;
+
+    }
+
+    // Read the events and check if one of them concerns the history
+    ssize_t size = 0;
+    while (
+      nbReady > 0 &&
+      (size =
+        read(
+          fd,
+          events,
+          sizeof(events))) > 0) {
+
+      for (
+        char* ptr = events;
+        ptr < events + size;) {
+
+        const struct inotify_event* event =
+          (const struct inotify_event*)ptr;
+        if (
+          event->len > 0 &&
+          strcmp(
+            event->name,
+            nameHistory) == 0) {
+
+          isChanged = true;
+
+        }
+
+        ptr += sizeof(struct inotify_event) + event->len;
+
+      }
+
+    }
+
+  }
+
+  // Update the image with the last appended births before stopping
+  if (
+    ret == true &&
+    isChanged == true) {
+
+    ret =
+      GAViewerFollowUpdate(
+        that,
+        &raster);
+
+  }
+
+  // Free memory
+  inotify_rm_watch(
+    fd,
+    wd);
+  close(fd);
+  free(pathDir);
+  RasterFree(&raster);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Load the births appended to the history file of the followed
+// GAViewer 'that' and redraw the changed epochs in the Raster 'raster'
+// and save it. If the appended births are incomplete, they are
+// discarded until the next change of the history
+// Return false if the image couldn't be saved, else true
+bool GAViewerFollowUpdate(
+  GAViewer* const that,
+    Raster* const raster) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (raster == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'raster' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Open the history, which may be missing while it's replaced
+  FILE* stream =
+    fopen(
+      that->pathHistory,
+      "rb");
+  if (stream == NULL) {
+
+    return true;
+
+  }
+
+  // Memorize the loaded births, to discard the appended ones if they
+  // are incomplete
+  NodeStore* store = &(that->nodes);
+  unsigned long nbEpoch = that->nbEpoch;
+  unsigned long maxId = that->maxId;
+  unsigned long nbNode = that->nbNode;
+  unsigned long nbBirth = store->nbBirth;
+  unsigned long offsetLastBirth = that->offsetLastBirth;
+
+  // Load the appended births
+  bool ret =
+    GAViewerLoadHistoryAppend(
+      that,
+      stream);
+  fclose(stream);
+  if (ret == false) {
+
+    // If the nodes were being rebuilt from the whole history, the
+    // previous ones are lost and the history is loaded again at its
+    // next change
+    if (offsetLastBirth == 0) {
+
+      GAViewerFreeNodes(that);
+
+    } else {
+
+      that->nbEpoch = nbEpoch;
+      that->maxId = maxId;
+      that->nbNode = nbNode;
+      store->nbBirth = nbBirth;
+      that->offsetLastBirth = offsetLastBirth;
+
+    }
+
+    printf("Waiting for the end of the appended births\n");
+    return true;
+
+  }
+
+  // If no displayed birth has been appended, nothing to redraw
+  if (store->nbBirth == nbBirth) {
+
+    return true;
+
+  }
+
+  // Get the first epoch having new nodes
+  unsigned long fromEpoch = ULONG_MAX;
+  for (
+    unsigned long iBirth = nbBirth;
+    iBirth < store->nbBirth;
+    ++iBirth) {
+
+    fromEpoch =
+      MIN(
+        fromEpoch,
+        store->births[iBirth].epoch);
+
+  }
+
+  // Update the layout, all the epochs are redrawn if it has changed
+  unsigned long toEpoch = that->toEpoch;
+  GAViewerFollowLayout(that);
+  if (that->toEpoch != toEpoch) {
+
+    fromEpoch = that->fromEpoch;
+
+  }
+
+  // Rank the new nodes
+  GAViewerRankNodes(that);
+
+  // Redraw the image from the first changed epoch
+  ret =
+    GAViewerFollowDraw(
+      that,
+      raster,
+      fromEpoch);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Set the last displayed epoch of the followed GAViewer 'that': the one
+// specified by the user if any, else leave room for as many epochs as
+// there are displayed ones when the last epoch reaches it
+void GAViewerFollowLayout(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  if (that->followToEpoch > 0) {
+
+    that->toEpoch = that->followToEpoch;
+
+  } else if (that->nbEpoch > that->toEpoch) {
+
+    unsigned long nbEpochDisp =
+      (that->nbEpoch > that->fromEpoch ?
+      that->nbEpoch - that->fromEpoch : 1);
+    that->toEpoch = that->fromEpoch + 2 * nbEpochDisp - 1;
+
+  }
+
+}
+
+// Redraw in the Raster 'raster' the columns of the followed GAViewer
+// 'that' from the epoch 'fromEpoch', and save it
+// Return true if successfull, else false
+bool GAViewerFollowDraw(
+    GAViewer* const that,
+      Raster* const raster,
+  unsigned long fromEpoch) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (raster == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'raster' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // If the changed epochs are not displayed, nothing to redraw
+  if (fromEpoch > that->toEpoch) {
+
+    return true;
+
+  }
+
+  // Clear and redraw the columns from the left of the first changed
+  // epoch, whose discs and curves are drawn from stepXEpoch * (j - 0.5)
+  // with j its displayed index, the primitives of the other epochs
+  // crossing these columns being clipped
+  float stepXEpoch =
+    GAViewerGetStepXEpoch(
+      that,
+      raster);
+  float jEpoch = 0.0f;
+  if (fromEpoch > that->fromEpoch) {
+
+    jEpoch = (float)(fromEpoch - that->fromEpoch);
+
+  }
+
+  raster->xMin =
+    MIN(
+      MAX(
+        (int)floorf(stepXEpoch * (jEpoch - 0.5f)) - 2,
+        0),
+      raster->width - 1);
+  StatsStartPhase("draw");
+  RasterFill(
+    raster,
+    RASTER_RGBA(255, 255, 255, 255));
+  if (that->nbThread > 1) {
+
+    GAViewerDrawHistoryTiled(
+      that,
+      raster);
+
+  } else {
+
+    GAViewerDrawHistory(
+      that,
+      raster);
+
+  }
+
+  raster->xMin = 0;
+
+  // Save the raster in a temporary file renamed once complete, so the
+  // image is never read partially written
+  StatsStartPhase("save");
+  char* pathTmp =
+    PBErrMalloc(
+      GAViewerErr,
+      strlen(that->pathHistoryImg) + 5);
+  sprintf(
+    pathTmp,
+    "%s.tmp",
+    that->pathHistoryImg);
+  bool ret =
+    RasterSave(
+      raster,
+      pathTmp,
+      that->formatHistoryImg,
+      that->nbThread);
+  ret =
+    ret &&
+    rename(
+      pathTmp,
+      that->pathHistoryImg) == 0;
+  if (ret == true) {
+
+    printf(
+      "Saved image [%s] of %lu epochs\n",
+      that->pathHistoryImg,
+      that->nbEpoch);
+
+  } else {
+
+    fprintf(
+      stderr,
+      "Couldn't save the image [%s]\n",
+      that->pathHistoryImg);
+
+  }
+
+  fflush(stdout);
+
+  // Free memory
+  free(pathTmp);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Handler of the signals stopping the follow mode
+void GAViewerFollowStop(int sig) {
+
+  (void)sig;
+  followIsStopped = 1;
+
+}
+
+// Create the image pyramid of the history in the directory 'path': a
+// Deep Zoom manifest and the tiles of each level, only the tiles
+// covering the epochs 'that->tilesFromEpoch' to 'that->tilesToEpoch'
+// being drawn
+// Return true if successfull, else false
+bool GAViewerHistoryToTiles(
+  GAViewer* const that,
+  const char* const path) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  if (that->nbEpoch == 0) {
+
+    return false;
+
+  }
+
+  // Calculate the dimensions of the most detailed level, from the nb
+  // of epochs and the nb of nodes of the largest epoch
+  const NodeStore* store = &(that->nodes);
+  uint64_t nbNodeMax = 0;
+  for (
+    unsigned long iEpoch = 0;
+    iEpoch < that->nbEpoch;
+    ++iEpoch) {
+
+    nbNodeMax =
+      MAX(
+        nbNodeMax,
+        store->first[iEpoch + 1] - store->first[iEpoch]);
+
+  }
+
+  uint64_t width = (uint64_t)(that->nbEpoch) * TILES_WIDTHEPOCH;
+  uint64_t height =
+    MIN(
+      MAX(
+        nbNodeMax * TILES_HEIGHTNODE,
+        (uint64_t)TILES_HEIGHTMIN),
+      (uint64_t)TILES_HEIGHTMAX);
+  if (width > INT_MAX) {
+
+    fprintf(
+      stderr,
+      "The history has too many epochs for an image pyramid\n");
+    return false;
+
+  }
+
+  // The image of the level 0 is 1 pixel, and its dimensions double
+  // up to the most detailed level
+  int levelMax = 0;
+  while (((uint64_t)1 << levelMax) < MAX(width, height)) {
+
+    ++levelMax;
+
+  }
+
+  // Create the directories of the levels
+  size_t lenPath = strlen(path) + strlen(TILES_NAME) + 64;
+  char* pathFile =
+    PBErrMalloc(
+      GAViewerErr,
+      lenPath);
+  bool ret = GAViewerMakeDir(path);
+  sprintf(
+    pathFile,
+    "%s/%s_files",
+    path,
+    TILES_NAME);
+  ret = ret && GAViewerMakeDir(pathFile);
+  for (
+    int level = 0;
+    level <= levelMax && ret == true;
+    ++level) {
+
+    sprintf(
+      pathFile,
+      "%s/%s_files/%d",
+      path,
+      TILES_NAME,
+      level);
+    ret = GAViewerMakeDir(pathFile);
+
+  }
+
+  // Save the manifest
+  if (ret == true) {
+
+    sprintf(
+      pathFile,
+      "%s/%s.dzi",
+      path,
+      TILES_NAME);
+    FILE* stream =
+      fopen(
+        pathFile,
+        "w");
+    if (stream != NULL) {
+
+      fprintf(
+        stream,
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n" \
+        "<Image xmlns=\"http://schemas.microsoft.com/deepzoom/2008\" " \
+        "TileSize=\"%d\" Overlap=\"0\" Format=\"png\">\n" \
+        "  <Size Width=\"%d\" Height=\"%d\"/>\n" \
+        "</Image>\n",
+        TILES_SIZE,
+        (int)width,
+        (int)height);
+      ret = (fclose(stream) == 0);
+
+    } else {
+
+      ret = false;
+
+    }
+
+  }
+
+  if (ret == false) {
+
+    fprintf(
+      stderr,
+      "Couldn't create the image pyramid [%s]\n",
+      path);
+    free(pathFile);
+    return false;
+
+  }
+
+  free(pathFile);
+
+  // Get the tiles to draw: at each level, the columns of tiles
+  // covering the requested epochs, and all their rows
+  uint64_t nbTile = 0;
+  uint64_t nbTileAlloc = 0;
+  TileRef* tiles = NULL;
+  for (
+    int level = levelMax;
+    level >= 0;
+    --level) {
+
+    int widthLevel =
+      GAViewerGetDimTiles(
+        (int)width,
+        level,
+        levelMax);
+    int heightLevel =
+      GAViewerGetDimTiles(
+        (int)height,
+        level,
+        levelMax);
+    float stepXEpoch = (float)widthLevel / (float)(that->nbEpoch);
+    int nbCol = (widthLevel + TILES_SIZE - 1) / TILES_SIZE;
+    int nbRow = (heightLevel + TILES_SIZE - 1) / TILES_SIZE;
+    int colFrom =
+      MAX(
+        (int)(stepXEpoch * ((float)(that->tilesFromEpoch) - 0.5f)) - 2,
+        0) / TILES_SIZE;
+    int colTo =
+      MIN(
+        (int)(stepXEpoch * ((float)(that->tilesToEpoch) + 1.0f)) + 2,
+        widthLevel - 1) / TILES_SIZE;
+    uint64_t nbTileLevel =
+      (uint64_t)(colTo - colFrom + 1) * (uint64_t)nbRow;
+    if (nbTile + nbTileLevel > nbTileAlloc) {
+
+      nbTileAlloc =
+        MAX(
+          2 * nbTileAlloc,
+          nbTile + nbTileLevel);
+      tiles =
+        realloc(
+          tiles,
+          sizeof(TileRef) * nbTileAlloc);
+      if (tiles == NULL) {
+
+        GAViewerErr->_type = PBErrTypeMallocFailed;
+        sprintf(
+          GAViewerErr->_msg,
+          "Couldn't allocate the tiles");
+        PBErrCatch(GAViewerErr);
+
+      }
+
+    }
+
+    for (
+      int col = colFrom;
+      col <= colTo && col < nbCol;
+      ++col) {
+
+      for (
+        int row = 0;
+        row < nbRow;
+        ++row) {
+
+        tiles[nbTile].level = level;
+        tiles[nbTile].col = col;
+        tiles[nbTile].row = row;
+        ++nbTile;
+
+      }
+
+    }
+
+  }
+
+  // Draw and save the tiles in parallel, one tile per chunk. The
+  // kernels are selected before as the threads create their Raster
+  if (rasterKernels == NULL) {
+
+    RasterSelectKernels(RasterGetKernels("auto"));
+
+  }
+
+  StatsStartPhase("tiles");
+  TilesTask task;
+  task.viewer = that;
+  task.path = path;
+  task.width = (int)width;
+  task.height = (int)height;
+  task.levelMax = levelMax;
+  task.tiles = tiles;
+  task.nbFail = 0;
+  if (nbTile > 0) {
+
+    ParallelFor(
+      that->nbThread,
+      nbTile,
+      nbTile,
+      GAViewerTaskDrawTiles,
+      &task);
+
+  }
+
+  ret = (task.nbFail == 0);
+  if (ret == true) {
+
+    printf(
+      "Saved %lu tiles of the image pyramid [%s/%s.dzi]\n",
+      (unsigned long)nbTile,
+      path,
+      TILES_NAME);
+
+  } else {
+
+    fprintf(
+      stderr,
+      "Couldn't save %lu tiles of the image pyramid [%s/%s.dzi]\n",
+      (unsigned long)(task.nbFail),
+      path,
+      TILES_NAME);
+
+  }
+
+  // Free memory
+  free(tiles);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Get the dimension of the level 'level' of the image pyramid from the
+// dimension 'dim' of its most detailed level 'levelMax'
+int GAViewerGetDimTiles(
+  const int dim,
+  const int level,
+  const int levelMax) {
+
+  int shift = levelMax - level;
+  return
+    (int)((((uint64_t)dim) + ((uint64_t)1 << shift) - 1) >> shift);
+
+}
+
+// Task drawing and saving tiles of the image pyramid, 'arg' is a
+// TilesTask
+void GAViewerTaskDrawTiles(
+      void* const arg,
+   const uint64_t from,
+   const uint64_t to,
+   const uint64_t iChunk) {
+
+  (void)iChunk;
+  TilesTask* task = arg;
+  char* path =
+    PBErrMalloc(
+      GAViewerErr,
+      strlen(task->path) + strlen(TILES_NAME) + 64);
+  for (
+    uint64_t iTile = from;
+    iTile < to;
+    ++iTile) {
+
+    // Create the raster of the tile as a window of the image of its
+    // level, the rows of tiles going from the top of the image
+    const TileRef* tile = task->tiles + iTile;
+    int widthLevel =
+      GAViewerGetDimTiles(
+        task->width,
+        tile->level,
+        task->levelMax);
+    int heightLevel =
+      GAViewerGetDimTiles(
+        task->height,
+        tile->level,
+        task->levelMax);
+    int widthTile =
+      MIN(
+        TILES_SIZE,
+        widthLevel - tile->col * TILES_SIZE);
+    int heightTile =
+      MIN(
+        TILES_SIZE,
+        heightLevel - tile->row * TILES_SIZE);
+    Raster raster =
+      RasterCreateStatic(
+        widthTile,
+        heightTile);
+    raster.widthImg = widthLevel;
+    raster.heightImg = heightLevel;
+    raster.originX = tile->col * TILES_SIZE;
+    raster.originY = heightLevel - tile->row * TILES_SIZE - heightTile;
+    raster.xMin = raster.originX;
+    raster.xMax = raster.originX + widthTile - 1;
+    raster.yMin = raster.originY;
+    raster.yMax = raster.originY + heightTile - 1;
+
+    // Draw the tile
+    RasterFill(
+      &raster,
+      RASTER_RGBA(255, 255, 255, 255));
+    GAViewerDrawHistory(
+      task->viewer,
+      &raster);
+
+    // Save the tile
+    sprintf(
+      path,
+      "%s/%s_files/%d/%d_%d.png",
+      task->path,
+      TILES_NAME,
+      tile->level,
+      tile->col,
+      tile->row);
+    bool ret =
+      RasterSave(
+        &raster,
+        path,
+        ImgFormatPng,
+        1);
+    if (ret == false) {
+
+      __atomic_fetch_add(
+        &(task->nbFail),
+        1,
+        __ATOMIC_RELAXED);
+
+    }
+
+    RasterFree(&raster);
+
+  }
+
+  // Free memory
+  free(path);
+
+}
+
+// Create the directory at 'path' if it doesn't exist yet
+// Return true if the directory exists, else false
+bool GAViewerMakeDir(const char* const path) {
+
+#if BUILDMODE == 0
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  if (
+    mkdir(
+      path,
+      0755) == 0) {
+
+    return true;
+
+  }
+
+  struct stat info;
+  return
+    errno == EEXIST &&
+    stat(
+      path,
+      &info) == 0 &&
+    S_ISDIR(info.st_mode);
+
+}
+
+// Load the jobs of the batch file at 'path' into the GAViewer 'that',
+// one job per line: '<from> <to> <width>,<height> <path/to/img>', the
+// empty lines and the ones starting with '#' being ignored
+// Return true if successfull, else false
+bool GAViewerLoadJobs(
+    GAViewer* const that,
+  const char* const path) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Open the jobs file
+  FILE* stream =
+    fopen(
+      path,
+      "r");
+  if (stream == NULL) {
+
+    fprintf(
+      stderr,
+      "Couldn't open the jobs file [%s]\n",
+      path);
+    return false;
+
+  }
+
+  // Replace the jobs of a previous jobs file
+  GAViewerFreeJobs(that);
+
+  // Loop on the lines
+  char line[4096];
+  unsigned long iLine = 0;
+  int nbJobAlloc = 0;
+  bool ret = true;
+  while (
+    ret == true &&
+    fgets(
+      line,
+      sizeof(line),
+      stream) != NULL) {
+
+    ++iLine;
+
+    // Skip the empty lines and the comments
+    char* ptr =
+      line +
+      strspn(
+        line,
+        " \t\r\n");
+    if (
+      *ptr == '\0' ||
+      *ptr == '#') {
+
+      continue;
+
+    }
+
+    // Decode the range of epochs and the size, the path of the image
+    // being the rest of the line without its trailing blanks
+    BatchJob job;
+    int posPath = 0;
+    int nbRead =
+      sscanf(
+        ptr,
+        "%lu %lu %d,%d %n",
+        &(job.fromEpoch),
+        &(job.toEpoch),
+        &(job.width),
+        &(job.height),
+        &posPath);
+    char* pathImg = ptr + posPath;
+    size_t lenPath = strlen(pathImg);
+    bool isComplete =
+      (lenPath > 0 &&
+      pathImg[lenPath - 1] == '\n') ||
+      feof(stream);
+    while (
+      lenPath > 0 &&
+      strchr(
+        " \t\r\n",
+        pathImg[lenPath - 1]) != NULL) {
+
+      --lenPath;
+
+    }
+
+    pathImg[lenPath] = '\0';
+    if (
+      nbRead != 4 ||
+      posPath == 0 ||
+      lenPath == 0 ||
+      isComplete == false ||
+      job.width <= 0 ||
+      job.height <= 0 ||
+      (job.toEpoch > 0 &&
+      job.toEpoch < job.fromEpoch)) {
+
+      fprintf(
+        stderr,
+        "The job at line %lu of [%s] is incorrect\n",
+        iLine,
+        path);
+      ret = false;
+      continue;
+
+    }
+
+    // Add the job
+    if (that->nbJob == nbJobAlloc) {
+
+      nbJobAlloc =
+        MAX(
+          2 * nbJobAlloc,
+          16);
+      that->jobs =
+        realloc(
+          that->jobs,
+          sizeof(BatchJob) * (size_t)nbJobAlloc);
+      if (that->jobs == NULL) {
+
+        GAViewerErr->_type = PBErrTypeMallocFailed;
+        sprintf(
+          GAViewerErr->_msg,
+          "Couldn't allocate the jobs");
+        PBErrCatch(GAViewerErr);
+
+      }
+
+    }
+
+    job.path = strdup(pathImg);
+    job.format = ImgFormatFromPath(job.path);
+    that->jobs[that->nbJob] = job;
+    ++(that->nbJob);
+
+  }
+
+  fclose(stream);
+  if (
+    ret == true &&
+    that->nbJob == 0) {
+
+    fprintf(
+      stderr,
+      "The jobs file [%s] has no job\n",
+      path);
+    ret = false;
+
+  }
+
+  // Return the success code
+  return ret;
+
+}
+
+// Free the jobs of the GAViewer 'that'
+void GAViewerFreeJobs(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  for (
+    int iJob = 0;
+    iJob < that->nbJob;
+    ++iJob) {
+
+    free(that->jobs[iJob].path);
+
+  }
+
+  free(that->jobs);
+  that->jobs = NULL;
+  that->nbJob = 0;
+
+}
+
+// Run the jobs of the GAViewer 'that': the nodes are ranked once per
+// first epoch, then the units of jobs with the same range of epochs are
+// run in parallel. A unit draws its largest image, and each image whose
+// dimensions don't divide the ones of an image already drawn, and the
+// other images are downscaled from the smallest image drawn whose
+// dimensions they divide
+// Return true if all the images were saved, else false
+bool GAViewerRunJobs(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Set the last epoch of the jobs displaying up to the last epoch of
+  // the history, and check their range
+  BatchJob* jobs = that->jobs;
+  for (
+    int iJob = 0;
+    iJob < that->nbJob;
+    ++iJob) {
+
+    if (
+      that->nbEpoch == 0 ||
+      jobs[iJob].fromEpoch > that->nbEpoch - 1) {
+
+      fprintf(
+        stderr,
+        "The first epoch of the job [%s] is beyond the history\n",
+        jobs[iJob].path);
+      return false;
+
+    }
+
+    if (
+      jobs[iJob].toEpoch == 0 ||
+      jobs[iJob].toEpoch > that->nbEpoch - 1) {
+
+      jobs[iJob].toEpoch = that->nbEpoch - 1;
+
+    }
+
+  }
+
+  // Sort the jobs to group them into units with the same range of
+  // epochs, and get the first job of each unit
+  qsort(
+    jobs,
+    (size_t)(that->nbJob),
+    sizeof(BatchJob),
+    BatchJobCmp);
+  int* firstJob =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(int) * (size_t)(that->nbJob + 1));
+  int nbUnit = 0;
+  for (
+    int iJob = 0;
+    iJob < that->nbJob;
+    ++iJob) {
+
+    if (
+      iJob == 0 ||
+      jobs[iJob].fromEpoch != jobs[iJob - 1].fromEpoch ||
+      jobs[iJob].toEpoch != jobs[iJob - 1].toEpoch) {
+
+      firstJob[nbUnit] = iJob;
+      ++nbUnit;
+
+    }
+
+  }
+
+  firstJob[nbUnit] = that->nbJob;
+
+  // The kernels are selected before as the threads create their Raster
+  if (rasterKernels == NULL) {
+
+    RasterSelectKernels(RasterGetKernels("auto"));
+
+  }
+
+  // Loop on the groups of units with the same first epoch
+  BatchTask task;
+  task.viewer = that;
+  task.jobs = jobs;
+  task.nbFail = 0;
+  int iUnit = 0;
+  while (iUnit < nbUnit) {
+
+    int iUnitEnd = iUnit + 1;
+    while (
+      iUnitEnd < nbUnit &&
+      jobs[firstJob[iUnitEnd]].fromEpoch ==
+        jobs[firstJob[iUnit]].fromEpoch) {
+
+      ++iUnitEnd;
+
+    }
+
+    // Rank the nodes up to the last epoch of the last unit of the
+    // group, the ranks of an epoch not depending on the following ones
+    that->fromEpoch = jobs[firstJob[iUnit]].fromEpoch;
+    that->toEpoch = jobs[firstJob[iUnitEnd] - 1].toEpoch;
+    GAViewerRankNodes(that);
+
+    // Run the units in parallel, the threads in excess being shared by
+    // the units to draw and save their images
+    StatsStartPhase("jobs");
+    int nbUnitGroup = iUnitEnd - iUnit;
+    task.firstJob = firstJob + iUnit;
+    task.nbThread =
+      MAX(
+        that->nbThread / nbUnitGroup,
+        1);
+    ParallelFor(
+      that->nbThread,
+      (uint64_t)nbUnitGroup,
+      (uint64_t)nbUnitGroup,
+      GAViewerTaskRunJobs,
+      &task);
+    iUnit = iUnitEnd;
+
+  }
+
+  bool ret = (task.nbFail == 0);
+  if (ret == true) {
+
+    printf(
+      "Ran %d jobs in %d units\n",
+      that->nbJob,
+      nbUnit);
+
+  } else {
+
+    fprintf(
+      stderr,
+      "Couldn't save %lu images of the jobs\n",
+      (unsigned long)(task.nbFail));
+
+  }
+
+  // Free memory
+  free(firstJob);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Comparison function of the BatchJob, for qsort, by increasing first
+// then last epoch, then decreasing nb of pixels
+int BatchJobCmp(
+  const void* a,
+  const void* b) {
+
+  const BatchJob* jobA = a;
+  const BatchJob* jobB = b;
+  if (jobA->fromEpoch != jobB->fromEpoch) {
+
+    return (jobA->fromEpoch < jobB->fromEpoch ? -1 : 1);
+
+  }
+
+  if (jobA->toEpoch != jobB->toEpoch) {
+
+    return (jobA->toEpoch < jobB->toEpoch ? -1 : 1);
+
+  }
+
+  uint64_t nbPixelA = (uint64_t)(jobA->width) * (uint64_t)(jobA->height);
+  uint64_t nbPixelB = (uint64_t)(jobB->width) * (uint64_t)(jobB->height);
+  if (nbPixelA != nbPixelB) {
+
+    return (nbPixelA > nbPixelB ? -1 : 1);
+
+  }
+
+  return
+    strcmp(
+      jobA->path,
+      jobB->path);
+
+}
+
+// Task running units of jobs with the same range of epochs, 'arg' is a
+// BatchTask
+void GAViewerTaskRunJobs(
+      void* const arg,
+   const uint64_t from,
+   const uint64_t to,
+   const uint64_t iChunk) {
+
+  (void)iChunk;
+  BatchTask* task = arg;
+  for (
+    uint64_t iUnit = from;
+    iUnit < to;
+    ++iUnit) {
+
+    // Display the range of epochs of the unit with a copy of the
+    // viewer sharing its nodes
+    int firstJob = task->firstJob[iUnit];
+    int nbJob = task->firstJob[iUnit + 1] - firstJob;
+    const BatchJob* jobs = task->jobs + firstJob;
+    GAViewer viewer = *(task->viewer);
+    viewer.fromEpoch = jobs[0].fromEpoch;
+    viewer.toEpoch = jobs[0].toEpoch;
+    viewer.nbThread = task->nbThread;
+
+    // Rasters of the jobs, the drawn ones being kept until the end of
+    // the unit to downscale them for the following jobs
+    Raster* rasters =
+      PBErrMalloc(
+        GAViewerErr,
+        sizeof(Raster) * (size_t)nbJob);
+    bool* isDrawn =
+      PBErrMalloc(
+        GAViewerErr,
+        sizeof(bool) * (size_t)nbJob);
+    for (
+      int iJob = 0;
+      iJob < nbJob;
+      ++iJob) {
+
+      // Search the smallest image drawn before whose dimensions are
+      // multiples of the ones of this image, the images being sorted
+      // by decreasing nb of pixels
+      const BatchJob* job = jobs + iJob;
+      int iSource = -1;
+      for (
+        int jJob = iJob - 1;
+        jJob >= 0 && iSource == -1;
+        --jJob) {
+
+        if (
+          isDrawn[jJob] == true &&
+          jobs[jJob].width % job->width == 0 &&
+          jobs[jJob].height % job->height == 0) {
+
+          iSource = jJob;
+
+        }
+
+      }
+
+      // Downscale that image, or else draw the history
+      rasters[iJob] =
+        RasterCreateStatic(
+          job->width,
+          job->height);
+      isDrawn[iJob] = (iSource == -1);
+      if (isDrawn[iJob] == false) {
+
+        RasterDownscale(
+          rasters + iSource,
+          rasters + iJob);
+
+      } else {
+
+        RasterFill(
+          rasters + iJob,
+          RASTER_RGBA(255, 255, 255, 255));
+        if (viewer.nbThread > 1) {
+
+          GAViewerDrawHistoryTiled(
+            &viewer,
+            rasters + iJob);
+
+        } else {
+
+          GAViewerDrawHistory(
+            &viewer,
+            rasters + iJob);
+
+        }
+
+      }
+
+      // Save the image
+      bool ret =
+        RasterSave(
+          rasters + iJob,
+          job->path,
+          job->format,
+          viewer.nbThread);
+      if (ret == true) {
+
+        printf(
+          "Saved image [%s]\n",
+          job->path);
+
+      } else {
+
+        fprintf(
+          stderr,
+          "Couldn't save the image [%s]\n",
+          job->path);
+        __atomic_fetch_add(
+          &(task->nbFail),
+          1,
+          __ATOMIC_RELAXED);
+
+      }
+
+      if (isDrawn[iJob] == false) {
+
+        RasterFree(rasters + iJob);
+
+      }
+
+    }
+
+    // Free memory
+    for (
+      int iJob = 0;
+      iJob < nbJob;
+      ++iJob) {
+
+      if (isDrawn[iJob] == true) {
+
+        RasterFree(rasters + iJob);
+
+      }
+
+    }
+
+    free(rasters);
+    free(isDrawn);
+
+  }
+
+}
+
+// Draw the part of the history inside the clipped columns and rows of
+// the Raster 'raster'
+void GAViewerDrawHistory(
+  const GAViewer* const that,
+         Raster* const raster) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Colors used to draw the genealogy
+  uint32_t colorEpoch = RASTER_RGBA(202, 202, 202, 255);
+  uint32_t colorBirth = RASTER_RGBA(0, 0, 0, 255);
+  uint32_t colorSurvive = RASTER_RGBA(255, 0, 0, 255);
+
+  // Calculate the step along x between two epochs
+  float stepXEpoch =
+    GAViewerGetStepXEpoch(
+      that,
+      raster);
+
+  // Calculate the bottom and top of the epoch lines
+  int height = raster->heightImg;
+  float yMinEpoch = 0.01 * (float)height;
+  float yMaxEpoch = 0.99 * (float)height;
+
+  // Get the range of epochs which may be drawn in the clipped columns,
+  // the epoch displayed at j being drawn between the columns
+  // stepXEpoch * (j - 0.5) and stepXEpoch * (j + 1) as the radius of
+  // its discs is at most half the step
+  unsigned long fromEpoch = that->fromEpoch;
+  unsigned long toEpoch = that->toEpoch;
+  float jFrom = (float)(raster->xMin - 1) / stepXEpoch - 1.0f;
+  float jTo = (float)(raster->xMax + 2) / stepXEpoch + 0.5f;
+  if (jFrom > 0.0f) {
+
+    fromEpoch += (unsigned long)jFrom;
+
+  }
+
+  if (jTo < (float)(toEpoch - that->fromEpoch)) {
+
+    toEpoch =
+      MIN(
+        toEpoch,
+        that->fromEpoch + (unsigned long)jTo + 1);
+
+  }
+
+  // Draw the epoch lines first as they are under the births
+  for (
+    unsigned long iEpoch = fromEpoch;
+    iEpoch <= toEpoch && iEpoch < that->nbEpoch;
+    ++iEpoch) {
+
+    if (
+      GAViewerIsEpochCovered(
+        that,
+        stepXEpoch,
+        iEpoch) == true) {
+
+      continue;
+
+    }
+
+    unsigned long jEpoch = iEpoch - that->fromEpoch;
+    RasterDrawVLine(
+      raster,
+      stepXEpoch * ((float)jEpoch + 0.5),
+      yMinEpoch,
+      yMaxEpoch,
+      colorEpoch);
+
+  }
+
+  // Buffers used by the epochs drawn in LOD mode
+  LodBuffer lod;
+  lod.counts = NULL;
+
+  // Loop on epochs
+  const NodeStore* store = &(that->nodes);
+  for (
+    unsigned long iEpoch = fromEpoch;
+    iEpoch <= toEpoch && iEpoch < that->nbEpoch;
+    ++iEpoch) {
+
+    // Skip the epoch if it's covered by the next one
+    if (
+      GAViewerIsEpochCovered(
+        that,
+        stepXEpoch,
+        iEpoch) == true) {
+
+      continue;
+
+    }
+
+    // Declare some parameters to calculate the position of the node
+    // and of its father
+    unsigned long jEpoch = iEpoch - that->fromEpoch;
+    uint64_t first = store->first[iEpoch];
+    uint32_t nbNode = store->first[iEpoch + 1] - first;
+    float stepYEpoch = (float)height / (float)nbNode;
+    float radiusCircle =
+      MIN(
+        stepYEpoch * 0.125,
+        stepXEpoch * 0.5);
+    float xNode = stepXEpoch * ((float)jEpoch + 0.5);
+    uint64_t firstPrev = 0;
+    float stepYPrev = 0.0;
+    if (jEpoch > 0) {
+
+      firstPrev = store->first[iEpoch - 1];
+      stepYPrev = (float)height / (float)(first - firstPrev);
+
+    }
+
+    // Skip the epoch if its discs and curves are outside the clipped
+    // columns
+    float xLeft =
+      MIN(
+        stepXEpoch * ((float)jEpoch - 0.5),
+        xNode - radiusCircle);
+    if (
+      xNode + radiusCircle + 1.0f < (float)(raster->xMin) ||
+      xLeft - 1.0f > (float)(raster->xMax + 1)) {
+
+      continue;
+
+    }
+
+    // Get the range of ranks of the nodes which may be drawn in the
+    // clipped rows
+    uint32_t rankFrom = 0;
+    uint32_t rankTo = nbNode - 1;
+    if (
+      raster->yMin > 0 ||
+      raster->yMax < height - 1) {
+
+      bool isVisible =
+        GAViewerGetRangeRankClip(
+          that,
+          raster,
+          iEpoch,
+          radiusCircle + 2.0f,
+          &rankFrom,
+          &rankTo);
+      if (isVisible == false) {
+
+        continue;
+
+      }
+
+    }
+
+    // If the epoch has more nodes than rows of pixels, draw it in LOD
+    // mode, whose cost is bounded by the size of the image rather
+    // than the nb of nodes
+    if (
+      that->isLod == true &&
+      nbNode > (uint32_t)height) {
+
+      // Extend the range of ranks to whole rows, so the bundles of the
+      // edges are the same as when the whole epoch is drawn
+      while (
+        rankFrom > 0 &&
+        (uint32_t)(stepYEpoch * ((float)rankFrom - 0.5)) ==
+        (uint32_t)(stepYEpoch * ((float)rankFrom + 0.5))) {
+
+        --rankFrom;
+
+      }
+
+      while (
+        rankTo < nbNode - 1 &&
+        (uint32_t)(stepYEpoch * ((float)rankTo + 1.5)) ==
+        (uint32_t)(stepYEpoch * ((float)rankTo + 0.5))) {
+
+        ++rankTo;
+
+      }
+
+      if (lod.counts == NULL) {
+
+        lod = LodBufferCreateStatic(height);
+
+      }
+
+      GAViewerDrawEpochLod(
+        that,
+        raster,
+        iEpoch,
+        rankFrom,
+        rankTo,
+        &lod);
+      continue;
+
+    }
+
+    // Loop on the birth for this epoch, in their rank order
+    for (
+      uint32_t iRank = rankFrom;
+      iRank <= rankTo;
+      ++iRank) {
+
+      // Get the node and its position, and skip it if it's not in the
+      // traced lineage
+      uint64_t iNode = first + store->order[first + iRank];
+      float yNode = stepYEpoch * ((float)iRank + 0.5);
+      if (GAViewerIsTraced(that, iNode) == false) {
+
+        continue;
+
+      }
+
+      // Draw the circle for this node
+      RasterDrawDisc(
+        raster,
+        xNode,
+        yNode,
+        radiusCircle,
+        colorBirth);
+
+      // If we are not on the first displayed epoch and the node has
+      // a parent, draw the curve between the child and its parent
+      uint32_t father = store->fatherIdx[iNode];
+      if (
+        jEpoch > 0 &&
+        father != NODE_NONE) {
+
+        float yFather =
+          stepYPrev *
+          ((float)(store->rank[firstPrev + father]) + 0.5);
+        float ctrl[8] = {
+          xNode, yNode,
+          stepXEpoch * (float)jEpoch, yNode,
+          stepXEpoch * (float)jEpoch, yFather,
+          stepXEpoch * ((float)jEpoch - 0.5), yFather
+        };
+        uint32_t colorCurve = colorBirth;
+        if (store->id[iNode] == store->id[firstPrev + father]) {
+
+          colorCurve = colorSurvive;
+
+        }
+
+        RasterDrawCurve(
+          raster,
+          ctrl,
+          colorCurve);
+
+      }
+
+    }
+
+  }
+
+  // Free memory
+  LodBufferFree(&lod);
+
+}
+
+// Get in 'rankFrom' and 'rankTo' the range of ranks of the nodes of
+// the epoch 'iEpoch' whose disc or edge to their father may be drawn in
+// the clipped rows of the Raster 'raster', 'margin' being the max
+// distance along y between a node and the pixels of its disc
+// Return false if there is no such node, else true
+bool GAViewerGetRangeRankClip(
+  const GAViewer* const that,
+   const Raster* const raster,
+   const unsigned long iEpoch,
+           const float margin,
+        uint32_t* const rankFrom,
+        uint32_t* const rankTo) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (raster == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'raster' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Declare some parameters to calculate the position of the nodes
+  // and of their fathers
+  const NodeStore* store = &(that->nodes);
+  float height = (float)(raster->heightImg);
+  uint64_t first = store->first[iEpoch];
+  uint32_t nbNode = store->first[iEpoch + 1] - first;
+  float stepYEpoch = height / (float)nbNode;
+  uint64_t firstPrev = 0;
+  float stepYPrev = 0.0;
+  if (iEpoch > that->fromEpoch) {
+
+    firstPrev = store->first[iEpoch - 1];
+    stepYPrev = height / (float)(first - firstPrev);
+
+  }
+
+  float yLow = (float)(raster->yMin) - margin;
+  float yHigh = (float)(raster->yMax + 1) + margin;
+
+  // The nodes with a father are ranked first, by rank of their father,
+  // so the positions of the nodes and of their fathers both increase
+  // with the rank. Search the nb of nodes with a father
+  uint32_t nbWithFather = 0;
+  if (iEpoch > that->fromEpoch) {
+
+    uint32_t iHigh = nbNode;
+    while (nbWithFather < iHigh) {
+
+      uint32_t iMid = nbWithFather + (iHigh - nbWithFather) / 2;
+      if (store->fatherIdx[first + store->order[first + iMid]] !=
+        NODE_NONE) {
+
+        nbWithFather = iMid + 1;
+
+      } else {
+
+        iHigh = iMid;
+
+      }
+
+    }
+
+  }
+
+  // Search the first node whose disc or edge reaches the bottom of the
+  // clipped rows, among the nodes with a father, then among the other
+  // ones. The bottom of an edge is the min of the positions of the node
+  // and its father, and its top is the max
+  for (
+    int iPass = 0;
+    iPass < 2;
+    ++iPass) {
+
+    uint32_t iLow = (iPass == 0 ? 0 : nbWithFather);
+    uint32_t iHigh = (iPass == 0 ? nbWithFather : nbNode);
+    while (iLow < iHigh) {
+
+      uint32_t iMid = iLow + (iHigh - iLow) / 2;
+      float yTop = stepYEpoch * ((float)iMid + 0.5);
+      if (iPass == 0) {
+
+        uint32_t father =
+          store->fatherIdx[first + store->order[first + iMid]];
+        yTop =
+          MAX(
+            yTop,
+            stepYPrev *
+            ((float)(store->rank[firstPrev + father]) + 0.5));
+
+      }
+
+      if (yTop < yLow) {
+
+        iLow = iMid + 1;
+
+      } else {
+
+        iHigh = iMid;
+
+      }
+
+    }
+
+    *rankFrom = iLow;
+    if (iLow < (iPass == 0 ? nbWithFather : nbNode)) {
+
+      break;
+
+    }
+
+  }
+
+  // Search the last node whose disc or edge reaches the top of the
+  // clipped rows, the bottom of the discs and edges increasing with the
+  // rank
+  uint32_t iLow = 0;
+  uint32_t iHigh = nbNode;
+  while (iLow < iHigh) {
+
+    uint32_t iMid = iLow + (iHigh - iLow) / 2;
+    float yBottom = stepYEpoch * ((float)iMid + 0.5);
+    if (iMid < nbWithFather) {
+
+      uint32_t father =
+        store->fatherIdx[first + store->order[first + iMid]];
+      yBottom =
+        MIN(
+          yBottom,
+          stepYPrev *
+          ((float)(store->rank[firstPrev + father]) + 0.5));
+
+    }
+
+    if (yBottom <= yHigh) {
+
+      iLow = iMid + 1;
+
+    } else {
+
+      iHigh = iMid;
+
+    }
+
+  }
+
+  // Return the range
+  if (iLow == 0 || *rankFrom >= nbNode) {
+
+    return false;
+
+  }
+
+  *rankTo = iLow - 1;
+  return (*rankFrom <= *rankTo);
+
+}
+
+// Draw the nodes of rank 'rankFrom' to 'rankTo' of the epoch 'iEpoch'
+// in the Raster 'raster' in LOD mode: the nodes are aggregated per row
+// of pixels and the edges to their fathers are aggregated into bundles
+// per rows of pixels, drawn with an intensity increasing with their nb
+// of edges, using the buffers 'buffer'
+void GAViewerDrawEpochLod(
+  const GAViewer* const that,
+         Raster* const raster,
+   const unsigned long iEpoch,
+        const uint32_t rankFrom,
+        const uint32_t rankTo,
+      LodBuffer* const buffer) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Declare some parameters to calculate the position of the nodes
+  // and of their fathers
+  const NodeStore* store = &(that->nodes);
+  int height = raster->heightImg;
+  float stepXEpoch =
+    GAViewerGetStepXEpoch(
+      that,
+      raster);
+  unsigned long jEpoch = iEpoch - that->fromEpoch;
+  uint64_t first = store->first[iEpoch];
+  uint32_t nbNode = store->first[iEpoch + 1] - first;
+  float stepYEpoch = (float)height / (float)nbNode;
+  float radiusCircle =
+    MIN(
+      stepYEpoch * 0.125,
+      stepXEpoch * 0.5);
+  float xNode = stepXEpoch * ((float)jEpoch + 0.5);
+  uint64_t firstPrev = 0;
+  uint32_t nbNodePrev = 0;
+  float stepYPrev = 0.0;
+  if (jEpoch > 0) {
+
+    firstPrev = store->first[iEpoch - 1];
+    nbNodePrev = first - firstPrev;
+    stepYPrev = (float)height / (float)nbNodePrev;
+
+  }
+
+  // Loop on the nodes in their rank order, which is also the order of
+  // their row
+  buffer->nbBundle = 0;
+  uint32_t rowCur = UINT32_MAX;
+  for (
+    uint32_t iRank = rankFrom;
+    iRank <= rankTo;
+    ++iRank) {
+
+    // Skip the node if it's not in the traced lineage
+    uint64_t iNode = first + store->order[first + iRank];
+    if (GAViewerIsTraced(that, iNode) == false) {
+
+      continue;
+
+    }
+
+    // Get the row of the node, and when it's a new row, add the
+    // bundles of the previous one and draw the disc of the new one
+    float yNode = stepYEpoch * ((float)iRank + 0.5);
+    uint32_t row =
+      MIN(
+        (uint32_t)yNode,
+        (uint32_t)height - 1);
+    if (row != rowCur) {
+
+      if (rowCur != UINT32_MAX) {
+
+        LodBufferFlushRow(
+          buffer,
+          rowCur);
+
+      }
+
+      rowCur = row;
+      RasterDrawDisc(
+        raster,
+        xNode,
+        (float)row + 0.5f,
+        radiusCircle,
+        RASTER_RGBA(0, 0, 0, 255));
+
+    }
+
+    // If the node has a father, add its edge to the bundle of its row
+    // and the row of its father
+    uint32_t father = store->fatherIdx[iNode];
+    if (
+      jEpoch > 0 &&
+      father != NODE_NONE) {
+
+      float yFather =
+        stepYPrev *
+        ((float)(store->rank[firstPrev + father]) + 0.5);
+      uint32_t rowFather =
+        MIN(
+          (uint32_t)yFather,
+          (uint32_t)height - 1);
+      uint32_t isSurvive =
+        (store->id[iNode] == store->id[firstPrev + father]);
+      uint32_t slot = 2 * rowFather + isSurvive;
+      if (buffer->counts[slot] == 0) {
+
+        // Fathers aggregated in a row are drawn from the center of
+        // the row, else from their own position
+        buffer->yFathers[slot] =
+          (nbNodePrev > (uint32_t)height ?
+            (float)rowFather + 0.5f : yFather);
+        buffer->touched[buffer->nbTouched] = slot;
+        ++(buffer->nbTouched);
+
+      }
+
+      ++(buffer->counts[slot]);
+
+    }
+
+  }
+
+  if (rowCur != UINT32_MAX) {
+
+    LodBufferFlushRow(
+      buffer,
+      rowCur);
+
+  }
+
+  // Draw the bundles
+  GAViewerDrawLodBundles(
+    that,
+    raster,
+    iEpoch,
+    nbNode,
+    buffer);
+
+}
+
+// Draw the bundles of the edges of the epoch 'iEpoch' of 'nbNode'
+// nodes aggregated in the LodBuffer 'buffer' in the Raster 'raster',
+// from the lightest to the darkest
+void GAViewerDrawLodBundles(
+  const GAViewer* const that,
+          Raster* const raster,
+    const unsigned long iEpoch,
+         const uint32_t nbNode,
+       LodBuffer* const buffer) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  int height = raster->heightImg;
+  float stepXEpoch =
+    GAViewerGetStepXEpoch(
+      that,
+      raster);
+  unsigned long jEpoch = iEpoch - that->fromEpoch;
+  float xNode = stepXEpoch * ((float)jEpoch + 0.5);
+
+  // Sort the bundles by increasing nb of edges, so the largest ones are
+  // drawn over the other ones
+  if (buffer->nbBundle > 1) {
+
+    qsort(
+      buffer->bundles,
+      buffer->nbBundle,
+      sizeof(LodBundle),
+      LodBundleCmp);
+
+  }
+
+  // Draw the bundles with an intensity going from 0.25 for one edge
+  // to 1 for the largest possible bundle, on a log scale. The bundles
+  // having one child row, they hold at most the nb of nodes per row,
+  // which doesn't depend on the range of ranks drawn, so the bundles
+  // get the same color whatever the part of the image drawn
+  uint32_t countMax =
+    (uint32_t)ceilf((float)nbNode / (float)height);
+
+  for (
+    uint64_t iBundle = 0;
+    iBundle < buffer->nbBundle;
+    ++iBundle) {
+
+    const LodBundle* bundle = buffer->bundles + iBundle;
+    float intensity = 1.0;
+    if (countMax > 1) {
+
+      intensity =
+        0.25 +
+        0.75 * logf((float)(bundle->count)) / logf((float)countMax);
+
+    }
+
+    // Blend the color of the curve with the white background
+    uint32_t light = (uint32_t)(255.0 * (1.0 - intensity) + 0.5);
+    uint32_t color = RASTER_RGBA(light, light, light, 255);
+    if (bundle->isSurvive != 0) {
+
+      color = RASTER_RGBA(255, light, light, 255);
+
+    }
+
+    float yNode = (float)(bundle->rowChild) + 0.5f;
+    float ctrl[8] = {
+      xNode, yNode,
+      stepXEpoch * (float)jEpoch, yNode,
+      stepXEpoch * (float)jEpoch, bundle->yFather,
+      stepXEpoch * ((float)jEpoch - 0.5), bundle->yFather
+    };
+    RasterDrawCurve(
+      raster,
+      ctrl,
+      color);
+
+  }
+
+}
+
+// Draw the epoch 'iEpoch' of the out-of-core mode, whose 'nbNode'
+// nodes in rank order are 'nodes' and whose previous epoch has
+// 'nbNodePrev' nodes, in the Raster 'raster', in LOD mode with the
+// buffers 'lod' if it has more nodes than rows of pixels
+void GAViewerDrawEpochOutOfCore(
+  const GAViewer* const that,
+          Raster* const raster,
+    const unsigned long iEpoch,
+   const GaoNode* const nodes,
+         const uint32_t nbNode,
+         const uint32_t nbNodePrev,
+       LodBuffer* const lod) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (lod == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'lod' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Colors used to draw the genealogy
+  uint32_t colorBirth = RASTER_RGBA(0, 0, 0, 255);
+  uint32_t colorSurvive = RASTER_RGBA(255, 0, 0, 255);
+
+  // Declare some parameters to calculate the position of the nodes
+  // and of their fathers, as GAViewerDrawHistory
+  int height = raster->heightImg;
+  float stepXEpoch =
+    GAViewerGetStepXEpoch(
+      that,
+      raster);
+  unsigned long jEpoch = iEpoch - that->fromEpoch;
+  float stepYEpoch = (float)height / (float)nbNode;
+  float radiusCircle =
+    MIN(
+      stepYEpoch * 0.125,
+      stepXEpoch * 0.5);
+  float xNode = stepXEpoch * ((float)jEpoch + 0.5);
+  float stepYPrev = 0.0;
+  if (jEpoch > 0) {
+
+    stepYPrev = (float)height / (float)nbNodePrev;
+
+  }
+
+  // If the epoch has more nodes than rows of pixels, draw it in LOD
+  // mode, as GAViewerDrawEpochLod
+  if (
+    that->isLod == true &&
+    nbNode > (uint32_t)height) {
+
+    if (lod->counts == NULL) {
+
+      *lod = LodBufferCreateStatic(height);
+
+    }
+
+    // Loop on the nodes in their rank order, which is also the order of
+    // their row
+    lod->nbBundle = 0;
+    uint32_t rowCur = UINT32_MAX;
+    for (
+      uint32_t iRank = 0;
+      iRank < nbNode;
+      ++iRank) {
+
+      // Get the row of the node, and when it's a new row, add the
+      // bundles of the previous one and draw the disc of the new one
+      float yNode = stepYEpoch * ((float)iRank + 0.5);
+      uint32_t row =
+        MIN(
+          (uint32_t)yNode,
+          (uint32_t)height - 1);
+      if (row != rowCur) {
+
+        if (rowCur != UINT32_MAX) {
+
+          LodBufferFlushRow(
+            lod,
+            rowCur);
+
+        }
+
+        rowCur = row;
+        RasterDrawDisc(
+          raster,
+          xNode,
+          (float)row + 0.5f,
+          radiusCircle,
+          colorBirth);
+
+      }
+
+      // If the node has a father, add its edge to the bundle of its row
+      // and the row of its father
+      uint32_t father = nodes[iRank].father & ~GAO_SURVIVE;
+      if (
+        jEpoch > 0 &&
+        father != GAO_NOFATHER) {
+
+        float yFather = stepYPrev * ((float)father + 0.5);
+        uint32_t rowFather =
+          MIN(
+            (uint32_t)yFather,
+            (uint32_t)height - 1);
+        uint32_t isSurvive = ((nodes[iRank].father & GAO_SURVIVE) != 0);
+        uint32_t slot = 2 * rowFather + isSurvive;
+        if (lod->counts[slot] == 0) {
+
+          lod->yFathers[slot] =
+            (nbNodePrev > (uint32_t)height ?
+              (float)rowFather + 0.5f : yFather);
+          lod->touched[lod->nbTouched] = slot;
+          ++(lod->nbTouched);
+
+        }
+
+        ++(lod->counts[slot]);
+
+      }
+
+    }
+
+    if (rowCur != UINT32_MAX) {
+
+      LodBufferFlushRow(
+        lod,
+        rowCur);
+
+    }
+
+    // Draw the bundles
+    GAViewerDrawLodBundles(
+      that,
+      raster,
+      iEpoch,
+      nbNode,
+      lod);
+    return;
+
+  }
+
+  // Loop on the birth for this epoch, in their rank order
+  for (
+    uint32_t iRank = 0;
+    iRank < nbNode;
+    ++iRank) {
+
+    // Draw the circle for this node
+    float yNode = stepYEpoch * ((float)iRank + 0.5);
+    RasterDrawDisc(
+      raster,
+      xNode,
+      yNode,
+      radiusCircle,
+      colorBirth);
+
+    // If we are not on the first displayed epoch and the node has
+    // a parent, draw the curve between the child and its parent
+    uint32_t father = nodes[iRank].father & ~GAO_SURVIVE;
+    if (
+      jEpoch > 0 &&
+      father != GAO_NOFATHER) {
+
+      float yFather = stepYPrev * ((float)father + 0.5);
+      float ctrl[8] = {
+        xNode, yNode,
+        stepXEpoch * (float)jEpoch, yNode,
+        stepXEpoch * (float)jEpoch, yFather,
+        stepXEpoch * ((float)jEpoch - 0.5), yFather
+      };
+      uint32_t colorCurve = colorBirth;
+      if ((nodes[iRank].father & GAO_SURVIVE) != 0) {
+
+        colorCurve = colorSurvive;
+
+      }
+
+      RasterDrawCurve(
+        raster,
+        ctrl,
+        colorCurve);
+
+    }
+
+  }
+
+}
+
+// Create a static LodBuffer for an image of 'height' pixels
+LodBuffer LodBufferCreateStatic(const int height) {
+
+  // Declare the new LodBuffer
+  LodBuffer that;
+
+  // Allocate the counters for each row of the image, for births and
+  // survivors
+  that.counts =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint32_t) * 2 * (size_t)height);
+  that.yFathers =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(float) * 2 * (size_t)height);
+  that.touched =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint32_t) * 2 * (size_t)height);
+  memset(
+    that.counts,
+    0,
+    sizeof(uint32_t) * 2 * (size_t)height);
+  that.nbTouched = 0;
+  that.bundles = NULL;
+  that.nbBundle = 0;
+  that.nbBundleAlloc = 0;
+
+  // Return the new LodBuffer
+  return that;
+
+}
+
+// Free the memory used by the LodBuffer 'that'
+void LodBufferFree(LodBuffer* const that) {
+
+  if (that == NULL || that->counts == NULL) return;
+
+  // Free memory
+  free(that->counts);
+  free(that->yFathers);
+  free(that->touched);
+  free(that->bundles);
+  that->counts = NULL;
+  that->yFathers = NULL;
+  that->touched = NULL;
+  that->bundles = NULL;
+
+}
+
+// Add the bundles of the edges of the row 'row' aggregated in the
+// LodBuffer 'that' to its bundles
+void LodBufferFlushRow(
+  LodBuffer* const that,
+    const uint32_t row) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Make sure there is enough memory for the new bundles
+  if (that->nbBundle + that->nbTouched > that->nbBundleAlloc) {
+
+    that->nbBundleAlloc =
+      MAX(
+        2 * that->nbBundleAlloc,
+        that->nbBundle + that->nbTouched);
+    that->bundles =
+      realloc(
+        that->bundles,
+        sizeof(LodBundle) * that->nbBundleAlloc);
+    if (that->bundles == NULL) {
+
+      GAViewerErr->_type = PBErrTypeMallocFailed;
+      sprintf(
+        GAViewerErr->_msg,
+        "Couldn't allocate the bundles");
+      PBErrCatch(GAViewerErr);
+
+    }
+
+  }
+
+  // Add the bundles and reset their counters
+  for (
+    uint32_t iTouched = 0;
+    iTouched < that->nbTouched;
+    ++iTouched) {
+
+    uint32_t slot = that->touched[iTouched];
+    LodBundle* bundle = that->bundles + that->nbBundle;
+    bundle->count = that->counts[slot];
+    bundle->rowChild = row;
+    bundle->rowFather = slot / 2;
+    bundle->isSurvive = slot % 2;
+    bundle->yFather = that->yFathers[slot];
+    ++(that->nbBundle);
+    that->counts[slot] = 0;
+
+  }
+
+  that->nbTouched = 0;
+
+}
+
+// Comparison function of the LodBundle, for qsort, by increasing nb of
+// edges then position
+int LodBundleCmp(
+  const void* a,
+  const void* b) {
+
+  const LodBundle* bundleA = a;
+  const LodBundle* bundleB = b;
+  uint32_t valA[4] = {
+    bundleA->count,
+    bundleA->rowChild,
+    bundleA->rowFather,
+    bundleA->isSurvive
+  };
+  uint32_t valB[4] = {
+    bundleB->count,
+    bundleB->rowChild,
+    bundleB->rowFather,
+    bundleB->isSurvive
+  };
+  for (
+    int iVal = 0;
+    iVal < 4;
+    ++iVal) {
+
+    if (valA[iVal] != valB[iVal]) {
+
+      return (valA[iVal] > valB[iVal]) - (valA[iVal] < valB[iVal]);
+
+    }
+
+  }
+
+  return 0;
+
+}
+
+// Get the step along x between two epoch lines of the GAViewer 'that'
+// for the Raster 'raster'
+float GAViewerGetStepXEpoch(
+  const GAViewer* const that,
+   const Raster* const raster) {
+
+  return
+    (float)(raster->widthImg) /
+    (float)(that->toEpoch - that->fromEpoch + 1);
+
+}
+
+// Return true if the epoch 'iEpoch' is not drawn by the GAViewer
+// 'that' because it shares its column of pixels with the next epoch
+// and only the last epoch of each column is drawn, 'stepXEpoch' being
+// the step along x between two epochs
+static inline bool GAViewerIsEpochCovered(
+  const GAViewer* const that,
+          const float stepXEpoch,
+  const unsigned long iEpoch) {
+
+  if (
+    that->isOneEpochPerColumn == false ||
+    iEpoch >= that->toEpoch ||
+    iEpoch + 1 >= that->nbEpoch) {
+
+    return false;
+
+  }
+
+  unsigned long jEpoch = iEpoch - that->fromEpoch;
+  return
+    (int)(stepXEpoch * ((float)jEpoch + 0.5)) ==
+    (int)(stepXEpoch * ((float)jEpoch + 1.5));
+
+}
+
+// Draw the history in the Raster 'raster' with 'that->nbThread' threads,
+// each drawing tiles of columns balanced by their nb of nodes and edges
+void GAViewerDrawHistoryTiled(
+  const GAViewer* const that,
+         Raster* const raster) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Cost of drawing each clipped column, the cost of an epoch being its
+  // nb of nodes and edges to the fathers, given to the column in the
+  // middle of its edges
+  int width = raster->xMax - raster->xMin + 1;
+  uint64_t* costs =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint64_t) * (size_t)width);
+  for (
+    int iCol = 0;
+    iCol < width;
+    ++iCol) {
+
+    costs[iCol] = 0;
+
+  }
+
+  float stepXEpoch =
+    GAViewerGetStepXEpoch(
+      that,
+      raster);
+  const NodeStore* store = &(that->nodes);
+  uint64_t costTotal = 0;
+  for (
+    unsigned long iEpoch = that->fromEpoch;
+    iEpoch <= that->toEpoch && iEpoch < that->nbEpoch;
+    ++iEpoch) {
+
+    // Skip the epochs left of the clipped columns, the ones on their
+    // left edge being given to the first column
+    unsigned long jEpoch = iEpoch - that->fromEpoch;
+    int iCol = (int)(stepXEpoch * (float)jEpoch) - raster->xMin;
+    if ((float)iCol + stepXEpoch < 0.0f) {
+
+      continue;
+
+    }
+
+    iCol =
+      MIN(
+        MAX(
+          iCol,
+          0),
+        width - 1);
+    uint64_t cost = 1;
+    for (
+      uint64_t iNode = store->first[iEpoch];
+      iNode < store->first[iEpoch + 1];
+      ++iNode) {
+
+      cost +=
+        (jEpoch > 0 && store->fatherIdx[iNode] != NODE_NONE ? 2 : 1);
+
+    }
+
+    costs[iCol] += cost;
+    costTotal += cost;
+
+  }
+
+  // Cut the columns into tiles of about the same cost, one column at
+  // least per tile
+  int nbTile =
+    MIN(
+      that->nbThread * RENDER_TILEPERTHREAD,
+      width);
+  int* tileX =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(int) * (size_t)(nbTile + 1));
+  tileX[0] = raster->xMin;
+  int iTile = 1;
+  uint64_t costSum = 0;
+  for (
+    int iCol = 0;
+    iCol < width && iTile < nbTile;
+    ++iCol) {
+
+    costSum += costs[iCol];
+    if (
+      costSum * (uint64_t)nbTile >= costTotal * (uint64_t)iTile ||
+      width - iCol - 1 <= nbTile - iTile) {
+
+      tileX[iTile] = raster->xMin + iCol + 1;
+      ++iTile;
+
+    }
+
+  }
+
+  nbTile = iTile;
+  tileX[nbTile] = raster->xMin + width;
+
+  // Give to each thread a queue of consecutive tiles
+  int nbThread =
+    MIN(
+      that->nbThread,
+      nbTile);
+  RenderQueue* queues =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(RenderQueue) * (size_t)nbThread);
+  for (
+    int iThread = 0;
+    iThread < nbThread;
+    ++iThread) {
+
+    pthread_mutex_init(
+      &(queues[iThread].mutex),
+      NULL);
+    queues[iThread].head = nbTile * iThread / nbThread;
+    queues[iThread].tail = nbTile * (iThread + 1) / nbThread;
+
+  }
+
+  RenderJob job;
+  job.viewer = that;
+  job.raster = raster;
+  job.tileX = tileX;
+  job.queues = queues;
+  job.nbThread = nbThread;
+
+  // Start the threads, the current thread being the first one
+  RenderWorker* workers =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(RenderWorker) * (size_t)nbThread);
+  pthread_t* threads =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(pthread_t) * (size_t)nbThread);
+  for (
+    int iThread = 0;
+    iThread < nbThread;
+    ++iThread) {
+
+    workers[iThread].job = &job;
+    workers[iThread].iThread = iThread;
+
+  }
+
+  for (
+    int iThread = 1;
+    iThread < nbThread;
+    ++iThread) {
+
+    int ret =
+      pthread_create(
+        threads + iThread,
+        NULL,
+        GAViewerRenderWorker,
+        workers + iThread);
+
+    // If the thread couldn't be created, its tiles will be stolen by
+    // the other threads
+    if (ret != 0) {
+
+      threads[iThread] = threads[0];
+      workers[iThread].job = NULL;
+
+    }
+
+  }
+
+  GAViewerRenderWorker(workers);
+
+  // Wait for the other threads
+  for (
+    int iThread = 1;
+    iThread < nbThread;
+    ++iThread) {
+
+    if (workers[iThread].job != NULL) {
+
+      pthread_join(
+        threads[iThread],
+        NULL);
+
+    }
+
+  }
+
+  // Free memory
+  for (
+    int iThread = 0;
+    iThread < nbThread;
+    ++iThread) {
+
+    pthread_mutex_destroy(&(queues[iThread].mutex));
+
+  }
+
+  free(threads);
+  free(workers);
+  free(queues);
+  free(tileX);
+  free(costs);
+
+}
+
+// Main function of the render threads, 'arg' is a RenderWorker
+void* GAViewerRenderWorker(void* arg) {
+
+  RenderWorker* worker = arg;
+  RenderJob* job = worker->job;
+
+  // Draw the tiles until there is none left, each tile is drawn with
+  // its own clipping of the shared raster, and the primitives
+  // overlapping several tiles are drawn in each of them in the same
+  // order, so the image is the same whatever the tiles
+  int iTile = 0;
+  while (
+    RenderJobNextTile(
+      job,
+      worker->iThread,
+      &iTile) == true) {
+
+    Raster raster = *(job->raster);
+    raster.xMin = job->tileX[iTile];
+    raster.xMax = job->tileX[iTile + 1] - 1;
+    GAViewerDrawHistory(
+      job->viewer,
+      &raster);
+
+  }
+
+  StatsFlush();
+  return NULL;
+
+}
+
+// Get the next tile to draw for the thread 'iThread' of the RenderJob
+// 'job' into 'iTile', from its own queue or else stolen from another
+// thread's queue
+// Return false if there is no more tile, else true
+bool RenderJobNextTile(
+  RenderJob* const job,
+    const int iThread,
+         int* const iTile) {
+
+  // Loop on the queues, starting with the thread's one
+  for (
+    int iQueue = 0;
+    iQueue < job->nbThread;
+    ++iQueue) {
+
+    RenderQueue* queue = job->queues + (iThread + iQueue) % job->nbThread;
+    bool isFound = false;
+    pthread_mutex_lock(&(queue->mutex));
+    if (queue->head < queue->tail) {
+
+      // Take the tile from the head of its own queue, or steal it from
+      // the tail of another queue
+      if (iQueue == 0) {
+
+        *iTile = queue->head;
+        ++(queue->head);
+
+      } else {
+
+        --(queue->tail);
+        *iTile = queue->tail;
+
+      }
+
+      isFound = true;
+
+    }
+
+    pthread_mutex_unlock(&(queue->mutex));
+    if (isFound == true) {
+
+      return true;
+
+    }
+
+  }
+
+  return false;
+
+}
+
+
+// Run the task 'task' with the argument 'arg' on 'nbItem' items split
+// into 'nbChunk' chunks of consecutive items, with 'nbThread' threads
+// taking the next chunk to run until all are done. The chunks are the
+// same whatever the nb of threads
+void ParallelFor(
+          const int nbThread,
+     const uint64_t nbItem,
+     const uint64_t nbChunk,
+  const ParallelTask task,
+         void* const arg) {
+
+#if BUILDMODE == 0
+  if (task == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'task' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (nbChunk == 0) {
+
+    GAViewerErr->_type = PBErrTypeInvalidArg;
+    sprintf(
+      GAViewerErr->_msg,
+      "'nbChunk' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  ParallelJob job;
+  job.task = task;
+  job.arg = arg;
+  job.nbItem = nbItem;
+  job.nbChunk = nbChunk;
+  job.nextChunk = 0;
+
+  // Start the threads, the current thread being the first one. If a
+  // thread couldn't be created, its chunks are run by the other threads
+  int nbThreadJob =
+    (int)MIN(
+      (uint64_t)MAX(
+        nbThread,
+        1),
+      nbChunk);
+  pthread_t* threads =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(pthread_t) * (size_t)nbThreadJob);
+  bool* isStarted =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(bool) * (size_t)nbThreadJob);
+  for (
+    int iThread = 1;
+    iThread < nbThreadJob;
+    ++iThread) {
+
+    isStarted[iThread] =
+      (pthread_create(
+        threads + iThread,
+        NULL,
+        ParallelWorker,
+        &job) == 0);
+
+  }
+
+  ParallelWorker(&job);
+
+  // Wait for the other threads
+  for (
+    int iThread = 1;
+    iThread < nbThreadJob;
+    ++iThread) {
+
+    if (isStarted[iThread] == true) {
+
+      pthread_join(
+        threads[iThread],
+        NULL);
+
+    }
+
+  }
+
+  // Free memory
+  free(isStarted);
+  free(threads);
+
+}
+
+// Main function of the threads of ParallelFor, 'arg' is a ParallelJob
+void* ParallelWorker(void* arg) {
+
+  ParallelJob* job = arg;
+
+  // Run the next chunk until there is none left
+  uint64_t iChunk =
+    __atomic_fetch_add(
+      &(job->nextChunk),
+      1,
+      __ATOMIC_RELAXED);
+  while (iChunk < job->nbChunk) {
+
+    job->task(
+      job->arg,
+      job->nbItem * iChunk / job->nbChunk,
+      job->nbItem * (iChunk + 1) / job->nbChunk,
+      iChunk);
+    iChunk =
+      __atomic_fetch_add(
+        &(job->nextChunk),
+        1,
+        __ATOMIC_RELAXED);
+
+  }
+
+  StatsFlush();
+  return NULL;
+
+}
+
+// Enable the statistics, reported in the format 'format'
+void StatsEnable(const StatsFormat format) {
+
+  memset(
+    &stats,
+    0,
+    sizeof(Stats));
+  stats.iPhase = -1;
+  stats.format = format;
+  statsIsEnabled = true;
+
+}
+
+// End the current phase of the statistics, if any, and start the phase
+// 'name'
+void StatsStartPhase(const char* const name) {
+
+#if BUILDMODE == 0
+  if (name == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'name' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  if (statsIsEnabled == false) {
+
+    return;
+
+  }
+
+  // Add the measures since the start of the current phase to it, the
+  // other threads having flushed their counters when they ended
+  double timeWall = GAViewerGetTime();
+  double timeCpu = StatsGetCpuTime();
+  StatsFlush();
+  if (stats.iPhase >= 0) {
+
+    StatsPhase* phase = stats.phases + stats.iPhase;
+    phase->timeWall += timeWall - stats.startWall;
+    phase->timeCpu += timeCpu - stats.startCpu;
+    struct rusage usage;
+    if (
+      getrusage(
+        RUSAGE_SELF,
+        &usage) == 0) {
+
+      phase->peakRss = usage.ru_maxrss;
+
+    }
+
+    phase->counters.nbSearch +=
+      stats.counters.nbSearch - stats.startCounters.nbSearch;
+    phase->counters.nbCompare +=
+      stats.counters.nbCompare - stats.startCounters.nbCompare;
+    phase->counters.nbShapoid +=
+      stats.counters.nbShapoid - stats.startCounters.nbShapoid;
+    phase->counters.nbCurve +=
+      stats.counters.nbCurve - stats.startCounters.nbCurve;
+    phase->counters.nbPixel +=
+      stats.counters.nbPixel - stats.startCounters.nbPixel;
+
+  }
+
+  // Search the new phase among the previous ones, else add it, the
+  // phases in excess being added to the last one
+  stats.iPhase = 0;
+  while (
+    stats.iPhase < stats.nbPhase &&
+    strcmp(
+      stats.phases[stats.iPhase].name,
+      name) != 0) {
+
+    ++(stats.iPhase);
+
+  }
+
+  if (stats.iPhase == stats.nbPhase) {
+
+    if (stats.nbPhase < STATS_NBPHASEMAX) {
+
+      stats.phases[stats.iPhase].name = name;
+      ++(stats.nbPhase);
+
+    } else {
+
+      --(stats.iPhase);
+
+    }
+
+  }
+
+  stats.startWall = timeWall;
+  stats.startCpu = timeCpu;
+  stats.startCounters = stats.counters;
+
+}
+
+// Add the counters of the current thread to the counters of all the
+// threads, and reset them
+void StatsFlush(void) {
+
+  if (statsIsEnabled == false) {
+
+    return;
+
+  }
+
+  __atomic_fetch_add(
+    &(stats.counters.nbSearch),
+    statsCounters.nbSearch,
+    __ATOMIC_RELAXED);
+  __atomic_fetch_add(
+    &(stats.counters.nbCompare),
+    statsCounters.nbCompare,
+    __ATOMIC_RELAXED);
+  __atomic_fetch_add(
+    &(stats.counters.nbShapoid),
+    statsCounters.nbShapoid,
+    __ATOMIC_RELAXED);
+  __atomic_fetch_add(
+    &(stats.counters.nbCurve),
+    statsCounters.nbCurve,
+    __ATOMIC_RELAXED);
+  __atomic_fetch_add(
+    &(stats.counters.nbPixel),
+    statsCounters.nbPixel,
+    __ATOMIC_RELAXED);
+  memset(
+    &statsCounters,
+    0,
+    sizeof(StatsCounters));
+
+}
+
+// End the current phase of the statistics and print the measures of
+// all the phases in the stream 'stream'
+void StatsPrint(FILE* const stream) {
+
+#if BUILDMODE == 0
+  if (stream == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'stream' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  if (statsIsEnabled == false) {
+
+    return;
+
+  }
+
+  // End the current phase, the phase started to do so being dropped
+  int nbPhase = stats.nbPhase;
+  StatsStartPhase("total");
+  stats.nbPhase = nbPhase;
+
+  // Declare the total of the phases, kept out of the phases so it
+  // doesn't overwrite one when their max nb is reached
+  StatsPhase total;
+  memset(
+    &total,
+    0,
+    sizeof(StatsPhase));
+  total.name = "total";
+
+  // Loop on the phases, and on the total at the end
+  if (stats.format == StatsFormatText) {
+
+    fprintf(
+      stream,
+      "%-12s %9s %9s %10s %12s %8s %10s %10s %12s\n",
+      "phase",
+      "wall(s)",
+      "cpu(s)",
+      "peakRSS(KB)",
+      "lookups",
+      "cmp/look",
+      "shapoids",
+      "curves",
+      "pixels");
+
+  } else {
+
+    fprintf(
+      stream,
+      "{\"phases\":[");
+
+  }
+
+  for (
+    int iPhase = 0;
+    iPhase < stats.nbPhase;
+    ++iPhase) {
+
+    const StatsPhase* phase = stats.phases + iPhase;
+    total.timeWall += phase->timeWall;
+    total.timeCpu += phase->timeCpu;
+    total.peakRss =
+      MAX(
+        total.peakRss,
+        phase->peakRss);
+    total.counters.nbSearch += phase->counters.nbSearch;
+    total.counters.nbCompare += phase->counters.nbCompare;
+    total.counters.nbShapoid += phase->counters.nbShapoid;
+    total.counters.nbCurve += phase->counters.nbCurve;
+    total.counters.nbPixel += phase->counters.nbPixel;
+
+  }
+
+  for (
+    int iPhase = 0;
+    iPhase <= stats.nbPhase;
+    ++iPhase) {
+
+    // The total is printed last
+    const StatsPhase* phase = &total;
+    if (iPhase < stats.nbPhase) {
+
+      phase = stats.phases + iPhase;
+
+    }
+
+    double nbCompareSearch =
+      (phase->counters.nbSearch > 0 ?
+        (double)(phase->counters.nbCompare) /
+        (double)(phase->counters.nbSearch) :
+        0.0);
+    if (stats.format == StatsFormatText) {
+
+      fprintf(
+        stream,
+        "%-12s %9.3f %9.3f %11ld %12lu %8.2f %10lu %10lu %12lu\n",
+        phase->name,
+        phase->timeWall,
+        phase->timeCpu,
+        phase->peakRss,
+        (unsigned long)(phase->counters.nbSearch),
+        nbCompareSearch,
+        (unsigned long)(phase->counters.nbShapoid),
+        (unsigned long)(phase->counters.nbCurve),
+        (unsigned long)(phase->counters.nbPixel));
+
+    } else {
+
+      fprintf(
+        stream,
+        "%s{\"name\":\"%s\",\"wall\":%.6f,\"cpu\":%.6f," \
+        "\"peakRssKB\":%ld,\"lookups\":%lu,\"comparesPerLookup\":%.3f," \
+        "\"shapoids\":%lu,\"curves\":%lu,\"pixels\":%lu}",
+        (phase == &total ? "],\"total\":" : (iPhase > 0 ? "," : "")),
+        phase->name,
+        phase->timeWall,
+        phase->timeCpu,
+        phase->peakRss,
+        (unsigned long)(phase->counters.nbSearch),
+        nbCompareSearch,
+        (unsigned long)(phase->counters.nbShapoid),
+        (unsigned long)(phase->counters.nbCurve),
+        (unsigned long)(phase->counters.nbPixel));
+
+    }
+
+  }
+
+  if (stats.format == StatsFormatJson) {
+
+    fprintf(
+      stream,
+      "}\n");
+
+  }
+
+  stats.iPhase = -1;
+
+}
+
+// Get the CPU time in seconds used by the process
+double StatsGetCpuTime(void) {
+
+  struct timespec time;
+  clock_gettime(
+    CLOCK_PROCESS_CPUTIME_ID,
+    &time);
+  return (double)(time.tv_sec) + (double)(time.tv_nsec) * 1e-9;
+
+}
+
+// Task counting the births per epoch in a chunk of births, 'arg' is a
+// BuildTask
+void GAViewerTaskCountBirths(
+      void* const arg,
+  const uint64_t from,
+  const uint64_t to,
+  const uint64_t iChunk) {
+
+  BuildTask* task = arg;
+  uint64_t* counts = task->counts + iChunk * task->nbEpoch;
+  for (
+    unsigned long iEpoch = 0;
+    iEpoch < task->nbEpoch;
+    ++iEpoch) {
+
+    counts[iEpoch] = 0;
+
+  }
+
+  for (
+    uint64_t iBirth = from;
+    iBirth < to;
+    ++iBirth) {
+
+    ++(counts[task->births[iBirth].epoch]);
+
+  }
+
+}
+
+// Task scattering a chunk of births to their epoch in the columns,
+// 'arg' is a BuildTask
+void GAViewerTaskScatterBirths(
+      void* const arg,
+  const uint64_t from,
+  const uint64_t to,
+  const uint64_t iChunk) {
+
+  BuildTask* task = arg;
+  uint64_t* counts = task->counts + iChunk * task->nbEpoch;
+  for (
+    uint64_t iBirth = from;
+    iBirth < to;
+    ++iBirth) {
+
+    const NodeBirth* birth = task->births + iBirth;
+    uint64_t iNode = counts[birth->epoch];
+    ++(counts[birth->epoch]);
+    task->id[iNode] = birth->id;
+    task->father[iNode] = birth->parents[0];
+    task->mother[iNode] = birth->parents[1];
+
+  }
+
+}
+
+// Task indexing the nodes of ranked epochs, 'arg' is a RankTask
+void GAViewerTaskIndexNodes(
+      void* const arg,
+  const uint64_t from,
+  const uint64_t to,
+  const uint64_t iChunk) {
+
+  (void)iChunk;
+  RankTask* task = arg;
+  for (
+    uint64_t iEpoch = from;
+    iEpoch < to;
+    ++iEpoch) {
+
+    GAViewerIndexNodes(
+      task->viewer,
+      task->fromEpoch + iEpoch);
+
+  }
+
+}
+
+// Task searching the fathers of ranked nodes, 'arg' is a RankTask
+void GAViewerTaskSearchFathers(
+      void* const arg,
+  const uint64_t from,
+  const uint64_t to,
+  const uint64_t iChunk) {
+
+  (void)iChunk;
+  RankTask* task = arg;
+  NodeStore* store = &(task->viewer->nodes);
+
+  // Get the epoch of the first node of the chunk
+  uint64_t fromNode = task->fromNode + from;
+  uint64_t toNode = task->fromNode + to;
+  unsigned long iEpoch = task->fromEpoch;
+  while (store->first[iEpoch + 1] <= fromNode) {
+
+    ++iEpoch;
+
+  }
+
+  // Loop on the nodes of the chunk, the nodes of the first ranked epoch
+  // having no father
+  for (
+    uint64_t iNode = fromNode;
+    iNode < toNode;
+    ++iNode) {
+
+    while (store->first[iEpoch + 1] <= iNode) {
+
+      ++iEpoch;
+
+    }
+
+    uint32_t father = NODE_NONE;
+    if (iEpoch > task->firstEpoch) {
+
+      father =
+        GAViewerSearchNode(
+          task->viewer,
+          iEpoch - 1,
+          store->father[iNode]);
+
+    }
+
+    store->fatherIdx[iNode] = father;
+
+  }
+
+}
+// Get the max id from the history
+unsigned long GAViewerHistoryGetMaxId(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // The max id is updated while the history is loaded
+  return that->maxId;
+
+}
+
+// Get the nb of epoch from the history
+unsigned long GAViewerHistoryGetNbEpoch(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // The nb of epoch is updated while the history is loaded
+  return that->nbEpoch;
+
+}
+
+// Load the history file 'that->pathHistory', converting it first to
+// a binary history if requested, and rank its nodes in the range of
+// displayed epochs
+// Return true if successfull, else false
+bool GAViewerLoad(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (that->pathHistory == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that->pathHistory' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  StatsStartPhase("load");
+
+  // Open the history file
+  FILE* stream =
+    fopen(
+      that->pathHistory,
+      "rb");
+  if (stream == NULL) {
+
+    return false;
+
+  }
+
+  // Make sure the nodes are empty
+  GAViewerFreeNodes(that);
+
+  // Check if the history file is a binary history
+  char magic[4] = {0};
+  size_t nbRead =
+    fread(
+      magic,
+      1,
+      4,
+      stream);
+  bool isBin =
+    nbRead == 4 &&
+    memcmp(
+      magic,
+      GAH_MAGIC,
+      4) == 0;
+  rewind(stream);
+
+  // Load the nodes from the history file
+  bool ret = false;
+
+  // Layout loaded from the layout cache, if any
+  LayoutCache cache = LayoutCacheCreateStatic();
+  bool isJson = false;
+  bool isCached = false;
+
+  // If the history must be converted, it's converted entirely
+  if (that->pathHistoryBin != NULL && isBin == false) {
+
+    ret = GAViewerConvertHistory(that);
+
+  // Else, if the history is a binary history, it's mapped in memory
+  // and only the displayed epochs will be ranked
+  } else if (isBin == true) {
+
+    ret =
+      GAViewerLoadBin(
+        that,
+        that->pathHistory);
+
+  // Else, only the displayed epochs and the one before are converted
+  // into nodes
+  } else {
+
+    that->loadFromEpoch = (that->fromEpoch > 0 ? that->fromEpoch - 1 : 0);
+    that->loadToEpoch = (that->toEpoch > 0 ? that->toEpoch : ULONG_MAX);
+    isJson = true;
+
+    // If the layout of the first loaded epochs is in the layout cache,
+    // their nodes are loaded from it, and only the births of the
+    // following epochs, if they are loaded, are read from the history
+    uint64_t offsetResume = 0;
+    isCached =
+      GAViewerLoadLayout(
+        that,
+        stream,
+        &cache,
+        &offsetResume);
+    if (isCached == true) {
+
+      ret =
+        offsetResume == 0 ||
+        GAViewerLoadHistoryRange(
+          that,
+          stream,
+          offsetResume);
+
+      // If the following births couldn't be read, the history is read
+      // without the layout cache
+      if (ret == false) {
+
+        GAViewerFreeNodes(that);
+        LayoutCacheFree(&cache);
+        isCached = false;
+
+      }
+
+    }
+
+    // The history has been read to check the layout cache, move back to
+    // its start
+    rewind(stream);
+
+    // If there is an up to date index of epochs for this history, and
+    // the range of epochs is restricted, read only this range
+    bool isRange =
+      isCached == false &&
+      (that->loadFromEpoch > 0 || that->loadToEpoch < ULONG_MAX) &&
+      GAViewerLoadEpochIndex(that) &&
+      that->epochIndex.isSorted == true &&
+      that->loadFromEpoch < that->epochIndex.nbEpoch;
+    if (isCached == true) {
+
+      ret = true;
+
+    } else if (isRange == true) {
+
+      ret =
+        GAViewerLoadHistoryRange(
+          that,
+          stream,
+          that->epochIndex.offsets[that->loadFromEpoch]);
+
+    // Else, read the whole history and index it for the next time
+    } else {
+
+      ret =
+        GAViewerLoadHistory(
+          that,
+          stream);
+      if (ret == true) {
+
+        GAViewerSaveEpochIndex(that);
+
+      }
+
+    }
+
+  }
+
+  // Close the history file
+  fclose(stream);
+
+  // If the history could be loaded
+  if (ret == true) {
+
+    // If the user hasn't specified a last epoch, set it to the last
+    // epoch, and ensure it is not greater than the last epoch
+    if (that->toEpoch == 0) {
+
+      that->toEpoch = that->nbEpoch - 1;
+
+    }
+
+    that->toEpoch =
+      MIN(
+        that->toEpoch,
+        that->nbEpoch - 1);
+
+    // Set the layout of the epochs loaded from the layout cache
+    if (isCached == true) {
+
+      GAViewerBuildNodes(that);
+      GAViewerApplyLayout(
+        that,
+        &cache);
+
+    }
+
+    // Sort the nodes
+    unsigned long nbEpochRanked = that->nodes.nbEpochRanked;
+    GAViewerRankNodes(that);
+
+    // If epochs of a JSON history have been ranked, save the layout
+    // for the next time
+    if (
+      isJson == true &&
+      that->nodes.nbEpochRanked > nbEpochRanked) {
+
+      StatsStartPhase("saveLayout");
+      GAViewerSaveLayout(
+        that,
+        &cache);
+
+    }
+
+  }
+
+  // Free memory
+  LayoutCacheFree(&cache);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Load the history of the GAViewer 'that' in the out-of-core mode: the
+// births are written in runs sorted by epoch in the directory
+// 'that->pathOoc', then ranked epoch by epoch into a layout file
+// Return true if successfull, else false
+bool GAViewerLoadOutOfCore(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (that->pathOoc == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that->pathOoc' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  StatsStartPhase("load");
+
+  // Open the history file
+  FILE* stream =
+    fopen(
+      that->pathHistory,
+      "rb");
+  if (stream == NULL) {
+
+    return false;
+
+  }
+
+  // Make sure the nodes are empty
+  GAViewerFreeNodes(that);
+
+  // A binary history is mapped in memory rather than decoded, so only
+  // the JSON histories are read out of core
+  char magic[4] = {0};
+  size_t nbRead =
+    fread(
+      magic,
+      1,
+      4,
+      stream);
+  rewind(stream);
+  if (
+    nbRead == 4 &&
+    memcmp(
+      magic,
+      GAH_MAGIC,
+      4) == 0) {
+
+    fprintf(
+      stderr,
+      "The out-of-core mode only reads JSON histories\n");
+    fclose(stream);
+    return false;
+
+  }
+
+  // Create the runs, to which GAViewerAddNode adds the births
+  OocRunsFree(&(that->oocRuns));
+  that->oocRuns = OocRunsCreate(that->pathOoc);
+  if (that->oocRuns == NULL) {
+
+    fprintf(
+      stderr,
+      "Couldn't create the directory [%s]\n",
+      that->pathOoc);
+    fclose(stream);
+    return false;
+
+  }
+
+  // Only the displayed epochs and the one before are loaded, reading
+  // only this range if there is an up to date index of epochs, else
+  // reading the whole history and indexing it for the next time
+  that->loadFromEpoch = (that->fromEpoch > 0 ? that->fromEpoch - 1 : 0);
+  that->loadToEpoch = (that->toEpoch > 0 ? that->toEpoch : ULONG_MAX);
+  bool isRange =
+    (that->loadFromEpoch > 0 || that->loadToEpoch < ULONG_MAX) &&
+    GAViewerLoadEpochIndex(that) &&
+    that->epochIndex.isSorted == true &&
+    that->loadFromEpoch < that->epochIndex.nbEpoch;
+  bool ret = false;
+  if (isRange == true) {
+
+    ret =
+      GAViewerLoadHistoryRange(
+        that,
+        stream,
+        that->epochIndex.offsets[that->loadFromEpoch]);
+
+  } else {
+
+    ret =
+      GAViewerLoadHistory(
+        that,
+        stream);
+    if (ret == true) {
+
+      GAViewerSaveEpochIndex(that);
+
+    }
+
+  }
+
+  // Close the history file
+  fclose(stream);
+
+  // Write the last buffered births
+  ret = ret && OocRunsFlush(that->oocRuns);
+
+  // The buffers of the runs aren't used anymore
+  free(that->oocRuns->births);
+  free(that->oocRuns->keys);
+  that->oocRuns->births = NULL;
+  that->oocRuns->keys = NULL;
+
+  // If the history could be loaded
+  if (ret == true) {
+
+    // If the user hasn't specified a last epoch, set it to the last
+    // epoch, and ensure it is not greater than the last epoch
+    if (that->toEpoch == 0) {
+
+      that->toEpoch = that->nbEpoch - 1;
+
+    }
+
+    that->toEpoch =
+      MIN(
+        that->toEpoch,
+        that->nbEpoch - 1);
+
+    // Rank the nodes into the layout file
+    StatsStartPhase("rank");
+    ret = GAViewerRankOutOfCore(that);
+
+  }
+
+  // Return the success code
+  return ret;
+
+}
+
+// Load the nodes from the history in the stream 'stream', and index
+// the epochs
+// Return true if successfull, else false
+bool GAViewerLoadHistory(
+  GAViewer* const that,
+     FILE* const stream) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (stream == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'stream' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Create the reader
+  HistReader* reader =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(HistReader));
+  *reader = HistReaderCreateStatic(stream);
+
+  // Index the epochs while reading the history
+  EpochIndexFree(&(that->epochIndex));
+  reader->epochIndex = &(that->epochIndex);
+
+  // Declare a variable to memorize the success of loading
+  bool ret = HistReaderExpect(
+    reader,
+    '{');
+
+  // Loop on the keys of the history until the end of the object
+  bool isEnd = HistReaderExpect(
+    reader,
+    '}');
+  while (ret == true && isEnd == false) {
+
+    // Read the key
+    char key[HISTREADER_KEYLENMAX];
+    ret =
+      HistReaderReadString(
+        reader,
+        key,
+        HISTREADER_KEYLENMAX) &&
+      HistReaderExpect(
+        reader,
+        ':');
+
+    // If the key is the genealogy, read the births, else skip
+    // the value
+    if (ret == true) {
+
+      if (strcmp(key, "_genealogy") == 0) {
+
+        ret =
+          HistReaderReadGenealogy(
+            reader,
+            that);
+
+      } else {
+
+        ret = HistReaderSkipValue(reader);
+
+      }
+
+    }
+
+    // Move to the next key
+    if (ret == true) {
+
+      isEnd =
+        HistReaderExpect(
+          reader,
+          '}');
+      if (isEnd == false) {
+
+        ret =
+          HistReaderExpect(
+            reader,
+            ',');
+
+      }
+
+    }
+
+  }
+
+  // If the history is invalid, tell the user where
+  if (ret == false) {
+
+    fprintf(
+      stderr,
+      "Invalid history at byte %lu\n",
+      reader->offset + reader->pos);
+
+  }
+
+  // Free memory
+  free(reader);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Get the summary of the history file 'that->pathHistory' into
+// 'that->epochIndex', from its index file if it's up to date, else by
+// reading the history without converting it into nodes
+// Return true if successfull, else false
+bool GAViewerLoadInfo(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // If the binary history or the index file are available, use them
+  if (that->pathHistoryBin == NULL) {
+
+    GahHeader header;
+    bool isBin =
+      GAViewerReadBinHeader(
+        that->pathHistory,
+        &header);
+
+    // If the history is a binary history, the summary is in its header
+    // and its index of epochs
+    if (isBin == true) {
+
+      bool ret =
+        GAViewerLoadBin(
+          that,
+          that->pathHistory);
+      if (ret == true) {
+
+        EpochIndexFree(&(that->epochIndex));
+        const NodeStore* store = &(that->nodes);
+        for (
+          unsigned long iEpoch = 0;
+          iEpoch < store->nbEpoch;
+          ++iEpoch) {
+
+          EpochIndexAddBirth(
+            &(that->epochIndex),
+            iEpoch,
+            0,
+            0);
+          that->epochIndex.nbBirthEpoch[iEpoch] =
+            store->first[iEpoch + 1] - store->first[iEpoch];
+
+        }
+
+        that->epochIndex.nbBirth = header.nbBirth;
+        that->epochIndex.maxId = header.maxId;
+
+      }
+
+      return ret;
+
+    }
+
+    if (GAViewerLoadEpochIndex(that) == true) {
+
+      return true;
+
+    }
+
+  }
+
+  // Open the history file
+  FILE* stream =
+    fopen(
+      that->pathHistory,
+      "rb");
+  if (stream == NULL) {
+
+    return false;
+
+  }
+
+  // Read the history, converting no epoch into nodes, and save its index
+  // for the next time
+  that->loadFromEpoch = ULONG_MAX;
+  that->loadToEpoch = ULONG_MAX;
+  bool ret =
+    GAViewerLoadHistory(
+      that,
+      stream);
+  fclose(stream);
+  if (ret == true) {
+
+    GAViewerSaveEpochIndex(that);
+
+  }
+
+  // Return the success code
+  return ret;
+
+}
+
+// Print the summary of the history of the GAViewer 'that' on the
+// stream 'stream'
+void GAViewerPrintInfo(
+  const GAViewer* const that,
+            FILE* const stream) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (stream == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'stream' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Get the min and max nb of births per epoch
+  const EpochIndex* index = &(that->epochIndex);
+  uint64_t nbBirthMin = 0;
+  uint64_t nbBirthMax = 0;
+  for (
+    unsigned long iEpoch = 0;
+    iEpoch < index->nbEpoch;
+    ++iEpoch) {
+
+    if (
+      iEpoch == 0 ||
+      index->nbBirthEpoch[iEpoch] < nbBirthMin) {
+
+      nbBirthMin = index->nbBirthEpoch[iEpoch];
+
+    }
+
+    nbBirthMax =
+      MAX(
+        nbBirthMax,
+        index->nbBirthEpoch[iEpoch]);
+
+  }
+
+  // Print the summary
+  fprintf(
+    stream,
+    "history: %s\n",
+    that->pathHistory);
+  fprintf(
+    stream,
+    "nbEpoch: %lu\n",
+    index->nbEpoch);
+  fprintf(
+    stream,
+    "nbBirth: %lu\n",
+    (unsigned long)(index->nbBirth));
+  fprintf(
+    stream,
+    "maxId: %lu\n",
+    (unsigned long)(index->maxId));
+  fprintf(
+    stream,
+    "nbBirthPerEpoch: min %lu max %lu\n",
+    (unsigned long)nbBirthMin,
+    (unsigned long)nbBirthMax);
+  for (
+    unsigned long iEpoch = 0;
+    iEpoch < index->nbEpoch;
+    ++iEpoch) {
+
+    fprintf(
+      stream,
+      "epoch %lu: %lu\n",
+      iEpoch,
+      (unsigned long)(index->nbBirthEpoch[iEpoch]));
+
+  }
+
+}
+
+// Load the nodes from the history in the stream 'stream' from the
+// offset 'offset' of the first birth of an epoch until the end of the
+// range of loaded epochs
+// Return true if successfull, else false
+bool GAViewerLoadHistoryRange(
+      GAViewer* const that,
+         FILE* const stream,
+  const uint64_t offset) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (stream == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'stream' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Move to the first birth
+  int retSeek =
+    fseek(
+      stream,
+      offset,
+      SEEK_SET);
+  if (retSeek != 0) {
+
+    return false;
+
+  }
+
+  // Create the reader starting from there
+  HistReader* reader =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(HistReader));
+  *reader = HistReaderCreateStatic(stream);
+  reader->offset = offset;
+
+  // Read the births until the end of the range of loaded epochs or the
+  // end of the genealogy
+  bool ret =
+    HistReaderReadBirths(
+      reader,
+      that);
+  ret =
+    ret &&
+    (reader->isStopped ||
+    HistReaderExpect(
+      reader,
+      ']'));
+
+  // If the history is invalid, tell the user where
+  if (ret == false) {
+
+    fprintf(
+      stderr,
+      "Invalid history at byte %lu\n",
+      reader->offset + reader->pos);
+
+  }
+
+  // Free memory
+  free(reader);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Get the path of the file with extension 'ext' beside the history
+// file of the GAViewer 'that'
+// Return a newly allocated string
+char* GAViewerGetSidecarPath(
+  const GAViewer* const that,
+      const char* const ext) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Append the extension to the path of the history
+  char* path =
+    PBErrMalloc(
+      GAViewerErr,
+      strlen(that->pathHistory) + strlen(ext) + 1);
+  sprintf(
+    path,
+    "%s%s",
+    that->pathHistory,
+    ext);
+
+  // Return the path
+  return path;
+
+}
+
+// Load the index of epochs and the summary of the history file from its
+// index file
+// Return true if the index file exists and is up to date, else false
+bool GAViewerLoadEpochIndex(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Get the size and modification time of the history file
+  struct stat st;
+  if (
+    stat(
+      that->pathHistory,
+      &st) != 0) {
+
+    return false;
+
+  }
+
+  // Open the index file
+  char* path =
+    GAViewerGetSidecarPath(
+      that,
+      GAI_EXT);
+  FILE* stream =
+    fopen(
+      path,
+      "rb");
+  free(path);
+  if (stream == NULL) {
+
+    return false;
+
+  }
+
+  // Read the header and check the index is up to date
+  GaiHeader header;
+  bool ret =
+    fread(
+      &header,
+      sizeof(GaiHeader),
+      1,
+      stream) == 1 &&
+    memcmp(
+      header.magic,
+      GAI_MAGIC,
+      4) == 0 &&
+    header.version == GAI_VERSION &&
+    header.srcSize == (uint64_t)st.st_size &&
+    header.srcMtime == (int64_t)st.st_mtime &&
+    header.nbEpoch < (uint64_t)st.st_size;
+
+  // Read the offsets of the epochs
+  if (ret == true) {
+
+    EpochIndexFree(&(that->epochIndex));
+    that->epochIndex.nbEpoch = header.nbEpoch;
+    that->epochIndex.nbEpochAlloc = header.nbEpoch;
+    that->epochIndex.isSorted = (header.isSorted != 0);
+    that->epochIndex.nbBirth = header.nbBirth;
+    that->epochIndex.maxId = header.maxId;
+    that->epochIndex.offsets =
+      PBErrMalloc(
+        GAViewerErr,
+        sizeof(uint64_t) * MAX(header.nbEpoch, 1));
+    that->epochIndex.nbBirthEpoch =
+      PBErrMalloc(
+        GAViewerErr,
+        sizeof(uint64_t) * MAX(header.nbEpoch, 1));
+    ret =
+      fread(
+        that->epochIndex.offsets,
+        sizeof(uint64_t),
+        header.nbEpoch,
+        stream) == header.nbEpoch &&
+      fread(
+        that->epochIndex.nbBirthEpoch,
+        sizeof(uint64_t),
+        header.nbEpoch,
+        stream) == header.nbEpoch;
+    if (ret == false) {
+
+      EpochIndexFree(&(that->epochIndex));
+
+    }
+
+  }
+
+  // Close the index file
+  fclose(stream);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Save the index of epochs and the summary of the history file into its
+// index file
+// Return true if successfull, else false
+bool GAViewerSaveEpochIndex(const GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Get the size and modification time of the history file
+  struct stat st;
+  if (
+    stat(
+      that->pathHistory,
+      &st) != 0) {
+
+    return false;
+
+  }
+
+  // Create the header
+  GaiHeader header;
+  memset(
+    &header,
+    0,
+    sizeof(GaiHeader));
+  memcpy(
+    header.magic,
+    GAI_MAGIC,
+    4);
+  header.version = GAI_VERSION;
+  header.srcSize = st.st_size;
+  header.srcMtime = st.st_mtime;
+  header.nbEpoch = that->epochIndex.nbEpoch;
+  header.isSorted = that->epochIndex.isSorted;
+  header.nbBirth = that->epochIndex.nbBirth;
+  header.maxId = that->epochIndex.maxId;
+
+  // Open the index file, it's not an error if it can't be created, the
+  // history will just be read entirely the next time
+  char* path =
+    GAViewerGetSidecarPath(
+      that,
+      GAI_EXT);
+  FILE* stream =
+    fopen(
+      path,
+      "wb");
+  free(path);
+  if (stream == NULL) {
+
+    return false;
+
+  }
+
+  // Write the header, and the offsets and the nb of births per epoch
+  // if there are epochs
+  bool ret =
+    fwrite(
+      &header,
+      sizeof(GaiHeader),
+      1,
+      stream) == 1;
+  if (header.nbEpoch > 0) {
+
+    ret =
+      ret &&
+      fwrite(
+        that->epochIndex.offsets,
+        sizeof(uint64_t),
+        header.nbEpoch,
+        stream) == header.nbEpoch &&
+      fwrite(
+        that->epochIndex.nbBirthEpoch,
+        sizeof(uint64_t),
+        header.nbEpoch,
+        stream) == header.nbEpoch;
+
+  }
+  ret = (fclose(stream) == 0) && ret;
+
+  // Return the success code
+  return ret;
+
+}
+
+// Load from the layout cache of the history file of the GAViewer 'that'
+// the nodes of the loaded epochs covered by its last valid checkpoint,
+// and their layout into 'cache'. The history in 'stream' is used to
+// check the checkpoints. 'offsetResume' is set to the offset in the
+// history from where the births of the following loaded epochs must be
+// read, or 0 if there is none
+// Return true if the nodes could be loaded from the cache, else false
+bool GAViewerLoadLayout(
+     GAViewer* const that,
+        FILE* const stream,
+  LayoutCache* const cache,
+     uint64_t* const offsetResume) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (stream == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'stream' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (cache == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'cache' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (offsetResume == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'offsetResume' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Open the layout cache
+  char* path =
+    GAViewerGetSidecarPath(
+      that,
+      GAL_EXT);
+  FILE* streamCache =
+    fopen(
+      path,
+      "rb");
+  free(path);
+  if (streamCache == NULL) {
+
+    return false;
+
+  }
+
+  // Read the header and check the layout starts at the first loaded
+  // epoch
+  GalHeader header;
+  bool ret =
+    fread(
+      &header,
+      sizeof(GalHeader),
+      1,
+      streamCache) == 1 &&
+    memcmp(
+      header.magic,
+      GAL_MAGIC,
+      4) == 0 &&
+    header.version == GAL_VERSION &&
+    header.fromEpoch == that->loadFromEpoch &&
+    header.nbEpoch > 0 &&
+    header.nbEpoch < UINT32_MAX &&
+    header.nbNode < UINT32_MAX &&
+    header.nbCheckpoint > 0 &&
+    header.nbCheckpoint <= header.nbEpoch;
+
+  // Read the checkpoints
+  GalCheckpoint* checkpoints = NULL;
+  if (ret == true) {
+
+    checkpoints =
+      PBErrMalloc(
+        GAViewerErr,
+        sizeof(GalCheckpoint) * header.nbCheckpoint);
+    ret =
+      fread(
+        checkpoints,
+        sizeof(GalCheckpoint),
+        header.nbCheckpoint,
+        streamCache) == header.nbCheckpoint;
+
+  }
+
+  // Search the last checkpoint whose part of the history hasn't
+  // changed, the hash of the history being continued from one
+  // checkpoint to the next so the history is read only once
+  long iCheckpoint = -1;
+  if (ret == true) {
+
+    fseek(
+      stream,
+      0,
+      SEEK_END);
+    uint64_t size = (uint64_t)ftell(stream);
+    uint64_t hash = GAH_HASHSEED;
+    uint64_t sizeHashed = 0;
+    for (
+      long iCheck = 0;
+      iCheck < (long)(header.nbCheckpoint);
+      ++iCheck) {
+
+      const GalCheckpoint* checkpoint = checkpoints + iCheck;
+      bool isValid =
+        checkpoint->epoch > header.fromEpoch &&
+        checkpoint->epoch <= header.fromEpoch + header.nbEpoch &&
+        checkpoint->srcSize <= size &&
+        (checkpoint->isComplete == 0 || checkpoint->srcSize == size);
+      if (isValid == true) {
+
+        if (checkpoint->srcSize < sizeHashed) {
+
+          hash = GAH_HASHSEED;
+          sizeHashed = 0;
+
+        }
+
+        hash =
+          GAViewerHashSourceRange(
+            stream,
+            hash,
+            sizeHashed,
+            checkpoint->srcSize);
+        sizeHashed = checkpoint->srcSize;
+        isValid = (hash == checkpoint->srcHash);
+
+      }
+
+      if (isValid == true) {
+
+        iCheckpoint = iCheck;
+
+      }
+
+    }
+
+  }
+
+  // The checkpoint can be used if it covers the loaded epochs, or if
+  // the births of the following epochs can be read after it
+  const GalCheckpoint* checkpoint = NULL;
+  bool isCovered = false;
+  if (iCheckpoint >= 0) {
+
+    checkpoint = checkpoints + iCheckpoint;
+    isCovered =
+      checkpoint->isComplete != 0 ||
+      that->loadToEpoch < checkpoint->epoch;
+    ret =
+      isCovered ||
+      checkpoint->srcOffset > 0;
+
+  } else {
+
+    ret = false;
+
+  }
+
+  // Read the index of the first node of each cached epoch, and check it
+  uint64_t* first = NULL;
+  if (ret == true) {
+
+    first =
+      PBErrMalloc(
+        GAViewerErr,
+        sizeof(uint64_t) * (header.nbEpoch + 1));
+    ret =
+      fread(
+        first,
+        sizeof(uint64_t),
+        header.nbEpoch + 1,
+        streamCache) == header.nbEpoch + 1 &&
+      first[0] == 0 &&
+      first[header.nbEpoch] == header.nbNode;
+    for (
+      uint64_t iEpoch = 0;
+      ret == true && iEpoch < header.nbEpoch;
+      ++iEpoch) {
+
+      ret = (first[iEpoch] <= first[iEpoch + 1]);
+
+    }
+
+  }
+
+  // Get the nb of loaded epochs, up to the checkpoint or the last
+  // loaded epoch, and their nb of nodes
+  unsigned long nbEpoch = 0;
+  uint64_t nbNode = 0;
+  if (ret == true) {
+
+    nbEpoch = checkpoint->epoch - header.fromEpoch;
+    if (that->loadToEpoch < checkpoint->epoch) {
+
+      nbEpoch = that->loadToEpoch + 1 - header.fromEpoch;
+
+    }
+
+    nbNode = first[nbEpoch];
+
+  }
+
+  // Read the columns of the loaded nodes, which are at the start of
+  // each column of the cached nodes
+  uint32_t* columns[5] = {NULL, NULL, NULL, NULL, NULL};
+  long offsetColumns = ftell(streamCache);
+  for (
+    int iColumn = 0;
+    ret == true && iColumn < 5;
+    ++iColumn) {
+
+    columns[iColumn] =
+      PBErrMalloc(
+        GAViewerErr,
+        sizeof(uint32_t) * MAX(nbNode, 1));
+    ret =
+      fseek(
+        streamCache,
+        offsetColumns +
+        (long)(sizeof(uint32_t) * header.nbNode * iColumn),
+        SEEK_SET) == 0 &&
+      fread(
+        columns[iColumn],
+        sizeof(uint32_t),
+        nbNode,
+        streamCache) == nbNode;
+
+  }
+
+  // Close the layout cache
+  fclose(streamCache);
+
+  // Add the loaded nodes, in the order of the cache which groups them
+  // by epoch
+  for (
+    unsigned long iEpoch = 0;
+    ret == true && iEpoch < nbEpoch;
+    ++iEpoch) {
+
+    for (
+      uint64_t iNode = first[iEpoch];
+      ret == true && iNode < first[iEpoch + 1];
+      ++iNode) {
+
+      ret =
+        GAViewerAddNode(
+          that,
+          header.fromEpoch + iEpoch,
+          columns[1][iNode],
+          columns[2][iNode],
+          columns[0][iNode]);
+
+    }
+
+  }
+
+  // If the nodes could be loaded
+  if (ret == true) {
+
+    // Keep the layout of the loaded nodes, and the checkpoints up to
+    // the used one
+    LayoutCacheFree(cache);
+    cache->fromEpoch = header.fromEpoch;
+    cache->nbEpoch = nbEpoch;
+    cache->first = first;
+    cache->rank = columns[3];
+    cache->fatherIdx = columns[4];
+    cache->checkpoints = checkpoints;
+    cache->nbCheckpoint = iCheckpoint + 1;
+    first = NULL;
+    columns[3] = NULL;
+    columns[4] = NULL;
+    checkpoints = NULL;
+
+    // Get where the births of the following epochs are, if they are
+    // loaded
+    *offsetResume = 0;
+    if (isCovered == false) {
+
+      *offsetResume = checkpoint->srcOffset;
+
+    } else if (checkpoint->isComplete != 0) {
+
+      that->offsetLastBirth = checkpoint->srcOffset;
+
+    }
+
+    // Tell the user on stderr, to keep stdout to the output of -info,
+    // -stats and -trace
+    fprintf(
+      stderr,
+      "Loaded the layout of epochs %lu to %lu from the layout cache\n",
+      cache->fromEpoch,
+      cache->fromEpoch + nbEpoch - 1);
+
+  }
+
+  // Free memory
+  free(checkpoints);
+  free(first);
+  for (
+    int iColumn = 0;
+    iColumn < 5;
+    ++iColumn) {
+
+    free(columns[iColumn]);
+
+  }
+
+  // Return the success code
+  return ret;
+
+}
+
+// Set the ranks of the nodes of the GAViewer 'that' to the layout
+// 'cache', for the epochs whose nodes are the cached ones, and index
+// them
+void GAViewerApplyLayout(
+           GAViewer* const that,
+  const LayoutCache* const cache) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (cache == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'cache' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Loop on the epochs of the layout, until one whose nodes are not
+  // the cached ones or whose layout is invalid
+  NodeStore* store = &(that->nodes);
+  unsigned long toEpoch = cache->fromEpoch;
+  bool isValid = true;
+  for (
+    unsigned long iEpoch = 0;
+    isValid == true && iEpoch < cache->nbEpoch;
+    ++iEpoch) {
+
+    // Check the epoch has the cached nodes
+    unsigned long epoch = cache->fromEpoch + iEpoch;
+    uint32_t nbNode = cache->first[iEpoch + 1] - cache->first[iEpoch];
+    isValid =
+      epoch < store->nbEpoch &&
+      store->first[epoch + 1] - store->first[epoch] == nbNode;
+
+    // Set the rank and the father of the nodes, checking the ranks are
+    // a permutation and the fathers are in the previous epoch
+    uint64_t first = 0;
+    uint32_t nbNodePrev = 0;
+    if (isValid == true) {
+
+      first = store->first[epoch];
+      if (iEpoch > 0) {
+
+        nbNodePrev = first - store->first[epoch - 1];
+
+      }
+
+      for (
+        uint32_t iNode = 0;
+        iNode < nbNode;
+        ++iNode) {
+
+        store->order[first + iNode] = NODE_NONE;
+
+      }
+
+    }
+
+    for (
+      uint32_t iNode = 0;
+      isValid == true && iNode < nbNode;
+      ++iNode) {
+
+      uint32_t rank = cache->rank[cache->first[iEpoch] + iNode];
+      uint32_t father = cache->fatherIdx[cache->first[iEpoch] + iNode];
+      isValid =
+        rank < nbNode &&
+        store->order[first + rank] == NODE_NONE &&
+        (father == NODE_NONE || father < nbNodePrev);
+      if (isValid == true) {
+
+        store->rank[first + iNode] = rank;
+        store->order[first + rank] = iNode;
+        store->fatherIdx[first + iNode] = father;
+
+      }
+
+    }
+
+    if (isValid == true) {
+
+      toEpoch = epoch + 1;
+
+    }
+
+  }
+
+  // Index the nodes of the epochs whose layout is set, as the fathers
+  // of the next epochs are searched among them, and memorize they are
+  // ranked
+  if (toEpoch > cache->fromEpoch) {
+
+    RankTask task;
+    task.viewer = that;
+    task.firstEpoch = cache->fromEpoch;
+    task.fromEpoch = cache->fromEpoch;
+    task.fromNode = store->first[cache->fromEpoch];
+    ParallelFor(
+      that->nbThread,
+      toEpoch - cache->fromEpoch,
+      toEpoch - cache->fromEpoch,
+      GAViewerTaskIndexNodes,
+      &task);
+    store->rankFromEpoch = cache->fromEpoch;
+    store->nbEpochRanked = toEpoch;
+
+  }
+
+}
+
+// Save the layout of the ranked epochs of the GAViewer 'that' into the
+// layout cache of its history file, with a checkpoint every
+// GAL_CHECKPOINT epochs, reusing the ones of 'cache' still valid if
+// the epoch index of the history is not available
+// Return true if successfull, else false
+bool GAViewerSaveLayout(
+           GAViewer* const that,
+  const LayoutCache* const cache) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (cache == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'cache' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Get the ranked epochs
+  NodeStore* store = &(that->nodes);
+  unsigned long fromEpoch = store->rankFromEpoch;
+  unsigned long toEpoch = store->nbEpochRanked;
+  if (toEpoch <= fromEpoch) {
+
+    return false;
+
+  }
+
+  // Open the history to get the hash of its parts
+  FILE* streamHist =
+    fopen(
+      that->pathHistory,
+      "rb");
+  if (streamHist == NULL) {
+
+    return false;
+
+  }
+
+  fseek(
+    streamHist,
+    0,
+    SEEK_END);
+  uint64_t size = (uint64_t)ftell(streamHist);
+
+  // The offsets of the epochs in the history are given by its epoch
+  // index if it's up to date and the births are sorted by epoch
+  if (that->epochIndex.nbEpoch == 0) {
+
+    GAViewerLoadEpochIndex(that);
+
+  }
+
+  const EpochIndex* index = &(that->epochIndex);
+  bool isIndexed =
+    index->isSorted == true &&
+    index->nbEpoch > 0;
+
+  // Create the checkpoints every GAL_CHECKPOINT epochs, from the epoch
+  // index or else from the previous checkpoints. The hash of the
+  // history is continued from one created checkpoint to the next so
+  // the history is read only once
+  uint64_t hash = GAH_HASHSEED;
+  uint64_t sizeHashed = 0;
+  unsigned long nbCheckpointMax = (toEpoch - fromEpoch) / GAL_CHECKPOINT + 1;
+  GalCheckpoint* checkpoints =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(GalCheckpoint) * nbCheckpointMax);
+  unsigned long nbCheckpoint = 0;
+  for (
+    unsigned long epoch = fromEpoch + GAL_CHECKPOINT;
+    epoch < toEpoch;
+    epoch += GAL_CHECKPOINT) {
+
+    GalCheckpoint* checkpoint = checkpoints + nbCheckpoint;
+    if (
+      isIndexed == true &&
+      epoch < index->nbEpoch) {
+
+      checkpoint->epoch = epoch;
+      checkpoint->srcSize = index->offsets[epoch];
+      if (checkpoint->srcSize < sizeHashed) {
+
+        hash = GAH_HASHSEED;
+        sizeHashed = 0;
+
+      }
+
+      hash =
+        GAViewerHashSourceRange(
+          streamHist,
+          hash,
+          sizeHashed,
+          checkpoint->srcSize);
+      sizeHashed = checkpoint->srcSize;
+      checkpoint->srcHash = hash;
+      checkpoint->srcOffset = index->offsets[epoch];
+      checkpoint->isComplete = 0;
+      ++nbCheckpoint;
+
+    } else {
+
+      for (
+        unsigned long iCheck = 0;
+        iCheck < cache->nbCheckpoint;
+        ++iCheck) {
+
+        if (
+          cache->checkpoints[iCheck].epoch == epoch &&
+          cache->checkpoints[iCheck].isComplete == 0) {
+
+          *checkpoint = cache->checkpoints[iCheck];
+          ++nbCheckpoint;
+
+        }
+
+      }
+
+    }
+
+  }
+
+  // Add the last checkpoint, covering the ranked epochs as long as the
+  // history is unchanged. They cover the whole genealogy if the
+  // history ends before the last loaded epoch
+  GalCheckpoint* checkpoint = checkpoints + nbCheckpoint;
+  checkpoint->epoch = toEpoch;
+  checkpoint->srcSize = size;
+  if (size < sizeHashed) {
+
+    hash = GAH_HASHSEED;
+    sizeHashed = 0;
+
+  }
+
+  checkpoint->srcHash =
+    GAViewerHashSourceRange(
+      streamHist,
+      hash,
+      sizeHashed,
+      size);
+  checkpoint->isComplete =
+    (that->nbEpoch == toEpoch &&
+    (that->loadToEpoch == ULONG_MAX ||
+    that->loadToEpoch >= toEpoch));
+  checkpoint->srcOffset = 0;
+  if (checkpoint->isComplete != 0) {
+
+    checkpoint->srcOffset = that->offsetLastBirth;
+
+  } else if (
+    isIndexed == true &&
+    toEpoch < index->nbEpoch) {
+
+    checkpoint->srcOffset = index->offsets[toEpoch];
+
+  }
+
+  ++nbCheckpoint;
+  fclose(streamHist);
+
+  // Create the header
+  GalHeader header;
+  memset(
+    &header,
+    0,
+    sizeof(GalHeader));
+  memcpy(
+    header.magic,
+    GAL_MAGIC,
+    4);
+  header.version = GAL_VERSION;
+  header.fromEpoch = fromEpoch;
+  header.nbEpoch = toEpoch - fromEpoch;
+  header.nbNode = store->first[toEpoch] - store->first[fromEpoch];
+  header.nbCheckpoint = nbCheckpoint;
+
+  // Get the index of the first node of each epoch relative to the first
+  // cached node
+  uint64_t* first =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint64_t) * (header.nbEpoch + 1));
+  for (
+    uint64_t iEpoch = 0;
+    iEpoch <= header.nbEpoch;
+    ++iEpoch) {
+
+    first[iEpoch] = store->first[fromEpoch + iEpoch] - store->first[fromEpoch];
+
+  }
+
+  // Open the layout cache, it's not an error if it can't be created,
+  // the layout will just be calculated again the next time
+  char* path =
+    GAViewerGetSidecarPath(
+      that,
+      GAL_EXT);
+  FILE* stream =
+    fopen(
+      path,
+      "wb");
+  free(path);
+  bool ret = (stream != NULL);
+
+  // Write the header, the checkpoints, the first nodes and the columns
+  if (ret == true) {
+
+    uint64_t firstNode = store->first[fromEpoch];
+    const uint32_t* columns[5] = {
+      store->id + firstNode,
+      store->father + firstNode,
+      store->mother + firstNode,
+      store->rank + firstNode,
+      store->fatherIdx + firstNode
+    };
+    ret =
+      fwrite(
+        &header,
+        sizeof(GalHeader),
+        1,
+        stream) == 1 &&
+      fwrite(
+        checkpoints,
+        sizeof(GalCheckpoint),
+        nbCheckpoint,
+        stream) == nbCheckpoint &&
+      fwrite(
+        first,
+        sizeof(uint64_t),
+        header.nbEpoch + 1,
+        stream) == header.nbEpoch + 1;
+    for (
+      int iColumn = 0;
+      ret == true && iColumn < 5;
+      ++iColumn) {
+
+      ret =
+        fwrite(
+          columns[iColumn],
+          sizeof(uint32_t),
+          header.nbNode,
+          stream) == header.nbNode;
+
+    }
+
+    ret = (fclose(stream) == 0) && ret;
+
+  }
+
+  // Free memory
+  free(first);
+  free(checkpoints);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Add the node 'id' born at epoch 'epoch' from 'father' and 'mother'
+// Return false if the node exceeds the 32 bits capacity of the
+// NodeStore, else true
+bool GAViewerAddNode(
+  GAViewer* const that,
+    unsigned long epoch,
+    unsigned long father,
+    unsigned long mother,
+    unsigned long id) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Check the node fits in the 32 bits columns, the last epoch value
+  // is reserved to keep the nb of epochs representable
+  if (
+    epoch >= UINT32_MAX ||
+    id > UINT32_MAX ||
+    father > UINT32_MAX ||
+    mother > UINT32_MAX) {
+
+    fprintf(
+      stderr,
+      "The birth of %lu (%lu, %lu) at epoch %lu exceeds the 32 bits " \
+      "capacity of the viewer\n",
+      id,
+      father,
+      mother,
+      epoch);
+    return false;
+
+  }
+
+  // If the node is outside the range of loaded epochs, ignore it
+  if (
+    epoch < that->loadFromEpoch ||
+    epoch > that->loadToEpoch) {
+
+    return true;
+
+  }
+
+  // In the out-of-core mode, add the birth to the runs of births
+  NodeStore* store = &(that->nodes);
+  if (that->oocRuns != NULL) {
+
+    NodeBirth birth;
+    birth.epoch = epoch;
+    birth.id = id;
+    birth.parents[0] = father;
+    birth.parents[1] = mother;
+    bool ret =
+      OocRunsAddBirth(
+        that->oocRuns,
+        &birth);
+    if (ret == false) {
+
+      return false;
+
+    }
+
+  // Else, add it to the births waiting to be stored
+  } else {
+
+    // Grow the births waiting to be stored if necessary, doubling their
+    // size to amortize the reallocations
+    if (store->nbBirth == store->nbBirthAlloc) {
+
+      store->nbBirthAlloc =
+        MAX(
+          1024,
+          2 * store->nbBirthAlloc);
+      store->births =
+        realloc(
+          store->births,
+          sizeof(NodeBirth) * store->nbBirthAlloc);
+      if (store->births == NULL) {
+
+        GAViewerErr->_type = PBErrTypeMallocFailed;
+        sprintf(
+          GAViewerErr->_msg,
+          "Failed to allocate %lu births",
+          store->nbBirthAlloc);
+        PBErrCatch(GAViewerErr);
+
+      }
+
+    }
+
+    // Add the birth
+    NodeBirth* birth = store->births + store->nbBirth;
+    birth->epoch = epoch;
+    birth->id = id;
+    birth->parents[0] = father;
+    birth->parents[1] = mother;
+    ++(store->nbBirth);
+
+  }
+
+  // Update the nb of epochs, the max id and the nb of nodes
+  that->nbEpoch =
+    MAX(
+      that->nbEpoch,
+      epoch + 1);
+  that->maxId =
+    MAX(
+      that->maxId,
+      id);
+  ++(that->nbNode);
+
+  // Return the success code
+  return true;
+
+}
+
+// Add the births waiting in the NodeStore of the GAViewer 'that' to
+// its columns, grouping them by epoch, and allocate the columns
+// calculated from them
+void GAViewerBuildNodes(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // If there is no waiting birth and the columns are already
+  // allocated, nothing to do
+  NodeStore* store = &(that->nodes);
+  if (
+    store->nbBirth == 0 &&
+    (store->arena != NULL || store->nbEpoch == 0)) {
+
+    return;
+
+  }
+
+  // If the waiting births can be appended to the end of the columns,
+  // the other epochs are unchanged
+  bool isAppended = GAViewerAppendNodes(that);
+  if (isAppended == true) {
+
+    return;
+
+  }
+
+  // If there is no waiting birth the id and parents columns are kept
+  // in place, which is the case for a binary history mapped in memory
+  bool inPlace = (store->nbBirth == 0);
+
+  // Count the nodes per epoch, already in the columns or waiting
+  unsigned long nbEpoch = that->nbEpoch;
+  unsigned long nbNode = store->nbNode + store->nbBirth;
+  uint64_t* count =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint64_t) * (nbEpoch + 1));
+  for (
+    unsigned long iEpoch = 0;
+    iEpoch <= nbEpoch;
+    ++iEpoch) {
+
+    count[iEpoch] = 0;
+    if (iEpoch < store->nbEpoch) {
+
+      count[iEpoch] = store->first[iEpoch + 1] - store->first[iEpoch];
+
+    }
+
+  }
+
+  // Count the waiting births per epoch in chunks of births, in
+  // parallel if there are several threads, each chunk having its own
+  // counters
+  uint64_t nbChunk = (uint64_t)(that->nbThread);
+  BuildTask task;
+  task.births = store->births;
+  task.nbEpoch = nbEpoch;
+  task.counts =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint64_t) * (nbEpoch + 1) * nbChunk);
+  ParallelFor(
+    that->nbThread,
+    store->nbBirth,
+    nbChunk,
+    GAViewerTaskCountBirths,
+    &task);
+  for (
+    uint64_t iChunk = 0;
+    iChunk < nbChunk;
+    ++iChunk) {
+
+    for (
+      unsigned long iEpoch = 0;
+      iEpoch < nbEpoch;
+      ++iEpoch) {
+
+      count[iEpoch] += task.counts[iChunk * nbEpoch + iEpoch];
+
+    }
+
+  }
+
+  // Get the nb of slots of the hash tables, keeping their load factor
+  // below 0.5
+  uint64_t nbSlot = 0;
+  for (
+    unsigned long iEpoch = 0;
+    iEpoch < nbEpoch;
+    ++iEpoch) {
+
+    if (count[iEpoch] >= NODE_NONE) {
+
+      GAViewerErr->_type = PBErrTypeInvalidArg;
+      sprintf(
+        GAViewerErr->_msg,
+        "Too many nodes at epoch %lu",
+        iEpoch);
+      PBErrCatch(GAViewerErr);
+
+    }
+
+    uint64_t nbSlotEpoch = 1;
+    while (nbSlotEpoch < 2 * count[iEpoch]) {
+
+      nbSlotEpoch <<= 1;
+
+    }
+
+    nbSlot += nbSlotEpoch;
+
+  }
+
+  // If births are added to columns already built, as when following a
+  // growing history, room is left for as many nodes, epochs and slots
+  // again so the next births can be appended in place
+  unsigned long nbNodeAlloc = nbNode;
+  unsigned long nbEpochAlloc = nbEpoch;
+  uint64_t nbSlotAlloc = nbSlot;
+  if (
+    store->arena != NULL &&
+    inPlace == false) {
+
+    nbNodeAlloc *= 2;
+    nbEpochAlloc *= 2;
+    nbSlotAlloc *= 2;
+
+  }
+
+  // Allocate the arena for all the columns
+  size_t sizeArena =
+    sizeof(uint64_t) * (nbEpochAlloc + 1) +
+    sizeof(uint32_t) * (3 * nbNodeAlloc + nbSlotAlloc);
+  if (inPlace == false) {
+
+    sizeArena +=
+      sizeof(uint64_t) * (nbEpochAlloc + 1) +
+      sizeof(uint32_t) * 3 * nbNodeAlloc;
+
+  }
+
+  unsigned char* arena =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(unsigned char) * sizeArena);
+  uint64_t* firstSlot = (uint64_t*)arena;
+  uint64_t* first = firstSlot + nbEpochAlloc + 1;
+  uint32_t* rank = (uint32_t*)(first + (inPlace ? 0 : nbEpochAlloc + 1));
+  uint32_t* order = rank + nbNodeAlloc;
+  uint32_t* fatherIdx = order + nbNodeAlloc;
+  uint32_t* slots = fatherIdx + nbNodeAlloc;
+
+  // Set the index of the first slot of each epoch
+  firstSlot[0] = 0;
+  for (
+    unsigned long iEpoch = 0;
+    iEpoch < nbEpoch;
+    ++iEpoch) {
+
+    uint64_t nbSlotEpoch = 1;
+    while (nbSlotEpoch < 2 * count[iEpoch]) {
+
+      nbSlotEpoch <<= 1;
+
+    }
+
+    firstSlot[iEpoch + 1] = firstSlot[iEpoch] + nbSlotEpoch;
+
+  }
+
+  // If the id and parents columns are kept in place
+  if (inPlace == true) {
+
+    // Release the previous columns, keeping the ones used in place
+    free(store->arena);
+
+  // Else, the id and parents columns are rebuilt
+  } else {
+
+    // Get the position of the columns in the arena
+    uint32_t* id = slots + nbSlotAlloc;
+    uint32_t* father = id + nbNodeAlloc;
+    uint32_t* mother = father + nbNodeAlloc;
+
+    // Set the index of the first node of each epoch
+    first[0] = 0;
+    for (
+      unsigned long iEpoch = 0;
+      iEpoch < nbEpoch;
+      ++iEpoch) {
+
+      first[iEpoch + 1] = first[iEpoch] + count[iEpoch];
+
+    }
+
+    // Copy the nodes already in the columns, and use the counters as
+    // the position where to add the next node of each epoch
+    for (
+      unsigned long iEpoch = 0;
+      iEpoch < nbEpoch;
+      ++iEpoch) {
+
+      count[iEpoch] = first[iEpoch];
+      if (iEpoch < store->nbEpoch) {
+
+        uint64_t nbNodeEpoch =
+          store->first[iEpoch + 1] - store->first[iEpoch];
+        memcpy(
+          id + first[iEpoch],
+          store->id + store->first[iEpoch],
+          sizeof(uint32_t) * nbNodeEpoch);
+        memcpy(
+          father + first[iEpoch],
+          store->father + store->first[iEpoch],
+          sizeof(uint32_t) * nbNodeEpoch);
+        memcpy(
+          mother + first[iEpoch],
+          store->mother + store->first[iEpoch],
+          sizeof(uint32_t) * nbNodeEpoch);
+        count[iEpoch] += nbNodeEpoch;
+
+      }
+
+    }
+
+    // Get the position of the first birth of each epoch of each
+    // chunk, the births of a chunk following the ones of the previous
+    // chunks
+    for (
+      unsigned long iEpoch = 0;
+      iEpoch < nbEpoch;
+      ++iEpoch) {
+
+      for (
+        uint64_t iChunk = 0;
+        iChunk < nbChunk;
+        ++iChunk) {
+
+        uint64_t nbBirthChunk = task.counts[iChunk * nbEpoch + iEpoch];
+        task.counts[iChunk * nbEpoch + iEpoch] = count[iEpoch];
+        count[iEpoch] += nbBirthChunk;
+
+      }
+
+    }
+
+    // Scatter the waiting births to their epoch, keeping their order,
+    // in parallel on the same chunks
+    task.id = id;
+    task.father = father;
+    task.mother = mother;
+    ParallelFor(
+      that->nbThread,
+      store->nbBirth,
+      nbChunk,
+      GAViewerTaskScatterBirths,
+      &task);
+
+    // Release the previous columns and the waiting births
+    NodeStoreFree(store);
+
+    // Update the columns
+    store->nbNode = nbNode;
+    store->nbEpoch = nbEpoch;
+    store->first = first;
+    store->id = id;
+    store->father = father;
+    store->mother = mother;
+
+  }
+
+  // Free memory
+  free(count);
+  free(task.counts);
+
+  // Update the store, the nodes having to be ranked again
+  store->arena = arena;
+  store->rank = rank;
+  store->order = order;
+  store->fatherIdx = fatherIdx;
+  store->firstSlot = firstSlot;
+  store->slots = slots;
+  store->nbNodeAlloc = nbNodeAlloc;
+  store->nbEpochAlloc = nbEpochAlloc;
+  store->nbSlotAlloc = nbSlotAlloc;
+  store->nbEpochRanked = 0;
+
+}
+
+// Append the births waiting in the NodeStore of the GAViewer 'that' to
+// the end of its columns, if they are sorted by epoch from the last
+// epoch of the columns and fit in the allocated columns. The nodes of
+// the other epochs keep their position, rank and hash table
+// Return true if the births were appended, else false
+bool GAViewerAppendNodes(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // The births can only be appended to columns built in the arena
+  NodeStore* store = &(that->nodes);
+  if (
+    store->arena == NULL ||
+    store->map != NULL ||
+    store->nbEpoch == 0 ||
+    store->nbBirth == 0) {
+
+    return false;
+
+  }
+
+  // Check the births are sorted by epoch from the last epoch of the
+  // columns
+  unsigned long lastEpoch = store->nbEpoch - 1;
+  unsigned long epoch = lastEpoch;
+  for (
+    unsigned long iBirth = 0;
+    iBirth < store->nbBirth;
+    ++iBirth) {
+
+    if (store->births[iBirth].epoch < epoch) {
+
+      return false;
+
+    }
+
+    epoch = store->births[iBirth].epoch;
+
+  }
+
+  // Check the nodes and epochs fit in the allocated columns
+  unsigned long nbEpoch = epoch + 1;
+  unsigned long nbNode = store->nbNode + store->nbBirth;
+  if (
+    nbNode > store->nbNodeAlloc ||
+    nbEpoch > store->nbEpochAlloc) {
+
+    return false;
+
+  }
+
+  // Check the hash tables of the last epochs fit in the allocated
+  // slots, keeping their load factor below 0.5
+  uint64_t nbSlot = store->firstSlot[lastEpoch];
+  unsigned long iBirth = 0;
+  for (
+    unsigned long iEpoch = lastEpoch;
+    iEpoch < nbEpoch;
+    ++iEpoch) {
+
+    uint64_t nbNodeEpoch = 0;
+    if (iEpoch == lastEpoch) {
+
+      nbNodeEpoch = store->first[lastEpoch + 1] - store->first[lastEpoch];
+
+    }
+
+    while (
+      iBirth < store->nbBirth &&
+      store->births[iBirth].epoch == iEpoch) {
+
+      ++nbNodeEpoch;
+      ++iBirth;
+
+    }
+
+    if (nbNodeEpoch >= NODE_NONE) {
+
+      return false;
+
+    }
+
+    uint64_t nbSlotEpoch = 1;
+    while (nbSlotEpoch < 2 * nbNodeEpoch) {
+
+      nbSlotEpoch <<= 1;
+
+    }
+
+    nbSlot += nbSlotEpoch;
+
+  }
+
+  if (nbSlot > store->nbSlotAlloc) {
+
+    return false;
+
+  }
+
+  // Append the births to the columns, which are in the arena
+  uint64_t* first = (uint64_t*)(store->first);
+  uint32_t* id = (uint32_t*)(store->id);
+  uint32_t* father = (uint32_t*)(store->father);
+  uint32_t* mother = (uint32_t*)(store->mother);
+  for (
+    unsigned long iBirth = 0;
+    iBirth < store->nbBirth;
+    ++iBirth) {
+
+    const NodeBirth* birth = store->births + iBirth;
+    uint64_t iNode = store->nbNode + iBirth;
+    id[iNode] = birth->id;
+    father[iNode] = birth->parents[0];
+    mother[iNode] = birth->parents[1];
+
+  }
+
+  // Update the first node and the first slot of the last epochs
+  iBirth = 0;
+  for (
+    unsigned long iEpoch = lastEpoch;
+    iEpoch < nbEpoch;
+    ++iEpoch) {
+
+    uint64_t nbNodeEpoch = 0;
+    if (iEpoch == lastEpoch) {
+
+      nbNodeEpoch = first[lastEpoch + 1] - first[lastEpoch];
+
+    }
+
+    while (
+      iBirth < store->nbBirth &&
+      store->births[iBirth].epoch == iEpoch) {
+
+      ++nbNodeEpoch;
+      ++iBirth;
+
+    }
+
+    uint64_t nbSlotEpoch = 1;
+    while (nbSlotEpoch < 2 * nbNodeEpoch) {
+
+      nbSlotEpoch <<= 1;
+
+    }
+
+    first[iEpoch + 1] = first[iEpoch] + nbNodeEpoch;
+    store->firstSlot[iEpoch + 1] = store->firstSlot[iEpoch] + nbSlotEpoch;
+
+  }
+
+  // If the last epoch of the columns got new nodes, it must be ranked
+  // again
+  if (store->births[0].epoch == lastEpoch) {
+
+    store->nbEpochRanked =
+      MIN(
+        store->nbEpochRanked,
+        lastEpoch);
+
+  }
+
+  // Update the store, keeping the memory of the births for the next
+  // ones
+  store->nbNode = nbNode;
+  store->nbEpoch = nbEpoch;
+  store->nbBirth = 0;
+
+  // Return the success code
+  return true;
+
+}
+
+// Free the nodes of the GAViewer 'that'
+void GAViewerFreeNodes(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Free the store, all the columns are released at once
+  NodeStoreFree(&(that->nodes));
+  that->nbEpoch = 0;
+  that->maxId = 0;
+  that->nbNode = 0;
+  that->offsetLastBirth = 0;
+
+}
+
+// Load the births appended to the history in the stream 'stream'
+// since the last birth loaded by the GAViewer 'that'. If the end of the
+// last loaded birth is unknown, the nodes are loaded again from the
+// whole history
+// Return true if successfull, else false
+bool GAViewerLoadHistoryAppend(
+  GAViewer* const that,
+     FILE* const stream) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (stream == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'stream' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // If the end of the last loaded birth is unknown, as when no birth
+  // has been loaded yet or the nodes come from the layout cache, the
+  // nodes are rebuilt from the whole history, else the births already
+  // loaded would be added again
+  if (that->offsetLastBirth == 0) {
+
+    GAViewerFreeNodes(that);
+    rewind(stream);
+    return
+      GAViewerLoadHistory(
+        that,
+        stream);
+
+  }
+
+  // Move to the end of the last loaded birth
+  int retSeek =
+    fseek(
+      stream,
+      that->offsetLastBirth,
+      SEEK_SET);
+  if (retSeek != 0) {
+
+    return false;
+
+  }
+
+  // Create the reader starting from there
+  HistReader* reader =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(HistReader));
+  *reader = HistReaderCreateStatic(stream);
+  reader->offset = that->offsetLastBirth;
+
+  // The last loaded birth is followed either by new births or by the
+  // end of the genealogy
+  bool ret = true;
+  if (
+    HistReaderExpect(
+      reader,
+      ',')) {
+
+    ret =
+      HistReaderReadBirths(
+        reader,
+        that);
+
+  }
+
+  ret =
+    ret &&
+    HistReaderExpect(
+      reader,
+      ']');
+
+  // If the history is invalid, tell the user where
+  if (ret == false) {
+
+    fprintf(
+      stderr,
+      "Invalid history at byte %lu\n",
+      reader->offset + reader->pos);
+
+  }
+
+  // Free memory
+  free(reader);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Read the header of the binary history file at 'path' into 'header'
+// Return true if it's a valid binary history file, else false
+bool GAViewerReadBinHeader(
+  const char* const path,
+   GahHeader* const header) {
+
+#if BUILDMODE == 0
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (header == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'header' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Open the file
+  FILE* stream =
+    fopen(
+      path,
+      "rb");
+  if (stream == NULL) {
+
+    return false;
+
+  }
+
+  // Read the header
+  size_t nbRead =
+    fread(
+      header,
+      sizeof(GahHeader),
+      1,
+      stream);
+  fclose(stream);
+
+  // Check the header
+  return
+    nbRead == 1 &&
+    memcmp(
+      header->magic,
+      GAH_MAGIC,
+      4) == 0 &&
+    header->version == GAH_VERSION;
+
+}
+
+// Load the nodes from the binary history file at 'path'
+// Return true if successfull, else false
+bool GAViewerLoadBin(
+    GAViewer* const that,
+  const char* const path) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Open the file and map it in memory
+  int fd =
+    open(
+      path,
+      O_RDONLY);
+  if (fd < 0) {
+
+    return false;
+
+  }
+
+  struct stat st;
+  if (
+    fstat(
+      fd,
+      &st) != 0 ||
+    (size_t)st.st_size < sizeof(GahHeader)) {
+
+    close(fd);
+    return false;
+
+  }
+
+  size_t size = st.st_size;
+  unsigned char* data =
+    mmap(
+      NULL,
+      size,
+      PROT_READ,
+      MAP_PRIVATE,
+      fd,
+      0);
+  close(fd);
+  if (data == MAP_FAILED) {
+
+    return false;
+
+  }
+
+  // Check the header and the size of the file, the nodes of the
+  // viewer must be empty
+  const GahHeader* header = (const GahHeader*)data;
+  bool ret =
+    memcmp(
+      header->magic,
+      GAH_MAGIC,
+      4) == 0 &&
+    header->version == GAH_VERSION &&
+    header->nbEpoch < size / sizeof(uint64_t) &&
+    header->nbBirth < size / sizeof(uint32_t) &&
+    size ==
+      sizeof(GahHeader) +
+      sizeof(uint64_t) * (header->nbEpoch + 1) +
+      sizeof(uint32_t) * 4 * header->nbBirth;
+
+  // Get the index of epochs and the columns
+  const uint64_t* first = (const uint64_t*)(header + 1);
+  const uint32_t* colId =
+    (const uint32_t*)(first + header->nbEpoch + 1) + header->nbBirth;
+
+  // Check the index of epochs
+  if (ret == true) {
+
+    ret = (first[0] == 0 && first[header->nbEpoch] == header->nbBirth);
+    for (
+      uint64_t iEpoch = 0;
+      ret == true && iEpoch < header->nbEpoch;
+      ++iEpoch) {
+
+      ret = (first[iEpoch] <= first[iEpoch + 1]);
+
+    }
+
+  }
+
+  // If the file is valid
+  if (ret == true) {
+
+    // Use the columns in place, the epoch column is not needed as the
+    // index of epochs gives the same information
+    NodeStore* store = &(that->nodes);
+    NodeStoreFree(store);
+    store->map = data;
+    store->mapSize = size;
+    store->nbNode = header->nbBirth;
+    store->nbEpoch = header->nbEpoch;
+    store->first = first;
+    store->id = colId;
+    store->father = colId + header->nbBirth;
+    store->mother = colId + 2 * header->nbBirth;
+
+    // Update the viewer
+    that->nbEpoch = header->nbEpoch;
+    that->nbNode = header->nbBirth;
+    that->maxId = header->maxId;
+    that->offsetLastBirth = header->srcOffset;
+
+  // Else, the file is invalid
+  } else {
+
+    munmap(
+      data,
+      size);
+
+  }
+
+  // Return the success code
+  return ret;
+
+}
+
+// Save the nodes of the GAViewer 'that' into the binary history file
+// at 'path'. 'stream' is the source history the nodes have been
+// loaded from
+// Return true if successfull, else false
+bool GAViewerSaveBin(
+     GAViewer* const that,
+  const char* const path,
+        FILE* const stream) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (stream == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'stream' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Make sure all the nodes are in the columns
+  GAViewerBuildNodes(that);
+
+  // Create the header
+  GahHeader header;
+  memset(
+    &header,
+    0,
+    sizeof(GahHeader));
+  memcpy(
+    header.magic,
+    GAH_MAGIC,
+    4);
+  header.version = GAH_VERSION;
+  header.nbBirth = that->nbNode;
+  header.nbEpoch = that->nbEpoch;
+  header.maxId = that->maxId;
+  header.srcOffset = that->offsetLastBirth;
+  header.srcHash =
+    GAViewerHashSource(
+      stream,
+      that->offsetLastBirth);
+
+  // Write into a temporary file, renamed once complete to never leave
+  // a truncated binary history
+  char* pathTmp =
+    PBErrMalloc(
+      GAViewerErr,
+      strlen(path) + 5);
+  sprintf(
+    pathTmp,
+    "%s.tmp",
+    path);
+  FILE* out =
+    fopen(
+      pathTmp,
+      "wb");
+  if (out == NULL) {
+
+    free(pathTmp);
+    return false;
+
+  }
+
+  bool ret =
+    fwrite(
+      &header,
+      sizeof(GahHeader),
+      1,
+      out) == 1;
+
+  // Write the index of the first birth of each epoch, the index of
+  // an empty history being its single null end
+  const NodeStore* store = &(that->nodes);
+  if (that->nbEpoch == 0) {
+
+    uint64_t first = 0;
+    ret =
+      ret &&
+      fwrite(
+        &first,
+        sizeof(uint64_t),
+        1,
+        out) == 1;
+
+  } else {
+
+    ret =
+      ret &&
+      fwrite(
+        store->first,
+        sizeof(uint64_t),
+        that->nbEpoch + 1,
+        out) == that->nbEpoch + 1;
+
+  }
+
+  // Write the epoch column
+  uint32_t epochs[1024];
+  for (
+    unsigned long iEpoch = 0;
+    ret == true && iEpoch < that->nbEpoch;
+    ++iEpoch) {
+
+    uint64_t nbNodeEpoch = store->first[iEpoch + 1] - store->first[iEpoch];
+    for (
+      uint64_t iNode = 0;
+      ret == true && iNode < nbNodeEpoch;
+      iNode += 1024) {
+
+      uint64_t nb =
+        MIN(
+          (uint64_t)1024,
+          nbNodeEpoch - iNode);
+      for (
+        uint64_t i = 0;
+        i < nb;
+        ++i) {
+
+        epochs[i] = iEpoch;
+
+      }
+
+      ret =
+        fwrite(
+          epochs,
+          sizeof(uint32_t),
+          nb,
+          out) == nb;
+
+    }
+
+  }
+
+  // Write the id and parents columns
+  const uint32_t* cols[3] = {
+    store->id,
+    store->father,
+    store->mother};
+  for (
+    int iCol = 0;
+    ret == true && that->nbNode > 0 && iCol < 3;
+    ++iCol) {
+
+    ret =
+      fwrite(
+        cols[iCol],
+        sizeof(uint32_t),
+        that->nbNode,
+        out) == that->nbNode;
+
+  }
+
+  // Close the file and replace the previous one
+  ret = (fclose(out) == 0) && ret;
+  if (ret == true) {
+
+    ret =
+      rename(
+        pathTmp,
+        path) == 0;
+
+  } else {
+
+    remove(pathTmp);
+
+  }
+
+  // Free memory
+  free(pathTmp);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Convert the history file of the GAViewer 'that' into the binary
+// history file 'that->pathHistoryBin'. If the binary history file
+// has already been created from the same history, only the births
+// appended to the history since then are decoded
+// Return true if successfull, else false
+bool GAViewerConvertHistory(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (that->pathHistory == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that->pathHistory' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (that->pathHistoryBin == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that->pathHistoryBin' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Open the history
+  FILE* stream =
+    fopen(
+      that->pathHistory,
+      "rb");
+  if (stream == NULL) {
+
+    return false;
+
+  }
+
+  // Get the size of the history
+  struct stat st;
+  if (
+    fstat(
+      fileno(stream),
+      &st) != 0) {
+
+    fclose(stream);
+    return false;
+
+  }
+
+  // If there is a binary history converted from the same history,
+  // which may have grown since then, reload it
+  bool isAppend = false;
+  GahHeader header;
+  bool retHeader =
+    GAViewerReadBinHeader(
+      that->pathHistoryBin,
+      &header);
+  if (
+    retHeader == true &&
+    header.srcOffset > 0 &&
+    header.srcOffset <= (uint64_t)st.st_size &&
+    header.srcHash ==
+      GAViewerHashSource(
+        stream,
+        header.srcOffset)) {
+
+    GAViewerFreeNodes(that);
+    isAppend =
+      GAViewerLoadBin(
+        that,
+        that->pathHistoryBin);
+
+  }
+
+  // Decode the appended births, or the whole history if we couldn't
+  // reuse the binary history
+  unsigned long nbNodeBin = 0;
+  bool ret = false;
+  if (isAppend == true) {
+
+    nbNodeBin = that->nbNode;
+    ret =
+      GAViewerLoadHistoryAppend(
+        that,
+        stream);
+
+  } else {
+
+    GAViewerFreeNodes(that);
+    rewind(stream);
+    ret =
+      GAViewerLoadHistory(
+        that,
+        stream);
+
+  }
+
+  // Save the binary history
+  if (ret == true) {
+
+    ret =
+      GAViewerSaveBin(
+        that,
+        that->pathHistoryBin,
+        stream);
+
+  }
+
+  // Close the history
+  fclose(stream);
+
+  // Display some info to the user
+  if (ret == true) {
+
+    printf(
+      "Converted %lu births (%lu new) into [%s]\n",
+      that->nbNode,
+      that->nbNode - nbNodeBin,
+      that->pathHistoryBin);
+
+  }
+
+  // Return the success code
+  return ret;
+
+}
+
+// Get the hash of the first 'size' bytes of the stream 'stream'
+uint64_t GAViewerHashSource(
+          FILE* const stream,
+  const unsigned long size) {
+
+  return
+    GAViewerHashSourceRange(
+      stream,
+      GAH_HASHSEED,
+      0,
+      size);
+
+}
+
+// Get the hash of the bytes 'from' to 'to' (excluded) of the stream
+// 'stream', continuing the hash 'hash' of the bytes before 'from'
+uint64_t GAViewerHashSourceRange(
+          FILE* const stream,
+       const uint64_t hash,
+  const unsigned long from,
+  const unsigned long to) {
+
+#if BUILDMODE == 0
+  if (stream == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'stream' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // FNV-1a hash of all the bytes of the range, the bytes missing if the
+  // stream is shorter than the range being hashed as their nb
+  uint64_t hashRange = hash;
+  unsigned char buffer[HISTREADER_BUFSIZE];
+  unsigned long pos = from;
+  if (
+    pos < to &&
+    fseek(
+      stream,
+      pos,
+      SEEK_SET) != 0) {
+
+    return (hashRange ^ (to - from)) * 1099511628211ull;
+
+  }
+
+  while (pos < to) {
+
+    size_t nbRead =
+      fread(
+        buffer,
+        1,
+        MIN(
+          (unsigned long)HISTREADER_BUFSIZE,
+          to - pos),
+        stream);
+    if (nbRead == 0) {
+
+      return (hashRange ^ (to - pos)) * 1099511628211ull;
+
+    }
+
+    for (
+      size_t iByte = 0;
+      iByte < nbRead;
+      ++iByte) {
+
+      hashRange = (hashRange ^ buffer[iByte]) * 1099511628211ull;
+
+    }
+
+    pos += nbRead;
+
+  }
+
+  // Return the hash
+  return hashRange;
+
+}
+
+// Sort the nodes of each displayed epoch, and the one before, according
+// to the rank of their father and index them
+void GAViewerRankNodes(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Make sure all the nodes are in the columns
+  StatsStartPhase("build");
+  GAViewerBuildNodes(that);
+  StatsStartPhase("rank");
+  NodeStore* store = &(that->nodes);
+
+  // Display some info to the user
+  printf(
+    "Decoded %ld epochs\n",
+    that->nbEpoch);
+
+  // If no epoch has been loaded, as when the first displayed epoch is
+  // beyond the end of the history, there is nothing to rank
+  if (that->nbEpoch == 0) {
+
+    return;
+
+  }
+
+  // Get the range of ranked epochs: the displayed epochs and the one
+  // before to position the fathers of the first displayed epoch. The
+  // first ranked epoch is sorted in the order of the history, so the
+  // layout doesn't depend on the epochs before it
+  unsigned long fromEpoch = (that->fromEpoch > 0 ? that->fromEpoch - 1 : 0);
+  unsigned long toEpoch =
+    MIN(
+      that->toEpoch,
+      that->nbEpoch - 1);
+
+  // If the same first epoch was ranked before, the ranks of the epochs
+  // whose nodes haven't changed since are still valid, and only the
+  // following epochs are ranked
+  unsigned long fromEpochRank = fromEpoch;
+  if (
+    store->rankFromEpoch == fromEpoch &&
+    store->nbEpochRanked > fromEpoch) {
+
+    fromEpochRank = store->nbEpochRanked;
+
+  }
+
+  // Get the max nb of nodes per epoch, including the epoch before the
+  // first ranked one as the keys go up to its nb of nodes
+  uint64_t nbNodeMax = 0;
+  for (
+    unsigned long iEpoch = (fromEpochRank > 0 ? fromEpochRank - 1 : 0);
+    iEpoch <= toEpoch && iEpoch < that->nbEpoch;
+    ++iEpoch) {
+
+    nbNodeMax =
+      MAX(
+        nbNodeMax,
+        store->first[iEpoch + 1] - store->first[iEpoch]);
+
+  }
+
+  // Create the index of the nodes of the ranked epochs, used to search
+  // the fathers of the nodes at the next epoch, then search the
+  // fathers, in parallel if there are several threads
+  RankTask task;
+  task.viewer = that;
+  task.firstEpoch = fromEpoch;
+  task.fromEpoch = fromEpochRank;
+  if (fromEpochRank <= toEpoch) {
+
+    task.fromNode = store->first[fromEpochRank];
+    ParallelFor(
+      that->nbThread,
+      toEpoch - fromEpochRank + 1,
+      toEpoch - fromEpochRank + 1,
+      GAViewerTaskIndexNodes,
+      &task);
+    ParallelFor(
+      that->nbThread,
+      store->first[toEpoch + 1] - task.fromNode,
+      (uint64_t)(that->nbThread) * RENDER_TILEPERTHREAD,
+      GAViewerTaskSearchFathers,
+      &task);
+
+  }
+
+  // Allocate memory for the sort keys and the buffers of the sort
+  RankSortBuffer buffer =
+    RankSortBufferCreateStatic(nbNodeMax);
+
+  // Loop on the epoch
+  for (
+    unsigned long iEpoch = fromEpochRank;
+    iEpoch <= toEpoch && iEpoch < that->nbEpoch;
+    ++iEpoch) {
+
+    // Get the nodes of this epoch
+    uint64_t first = store->first[iEpoch];
+    uint32_t nbNode = store->first[iEpoch + 1] - first;
+
+    // Display some info to the user
+    printf(
+      "Number of nodes in epoch #%ld :%u\n",
+      iEpoch,
+      nbNode);
+
+    // The nodes of the first ranked epoch keep their order in the
+    // history
+    if (iEpoch == fromEpoch) {
+
+      for (
+        uint32_t iNode = 0;
+        iNode < nbNode;
+        ++iNode) {
+
+        store->order[first + iNode] = iNode;
+
+      }
+
+    // Else, the nodes are sorted on the rank of their father
+    } else {
+
+      // The keys are the ranks in the previous epoch, or nbNode
+      uint32_t keyMax =
+        MAX(
+          nbNode,
+          (uint32_t)(first - store->first[iEpoch - 1]));
+
+      // Loop on the nodes at this epoch
+      for (
+        uint32_t iNode = 0;
+        iNode < nbNode;
+        ++iNode) {
+
+        // If there is a father, the sort value of the node is the rank
+        // of the parent, else it's the nb of nodes in the epoch
+        uint32_t father = store->fatherIdx[first + iNode];
+        if (father != NODE_NONE) {
+
+          buffer.keys[iNode] = store->rank[store->first[iEpoch - 1] + father];
+
+        } else {
+
+          buffer.keys[iNode] = nbNode;
+
+        }
+
+      }
+
+      // Sort the nodes of the current epoch
+      RankSort(
+        &buffer,
+        nbNode,
+        keyMax,
+        store->id + first,
+        store->order + first);
+
+    }
+
+    // Set the rank of the nodes to their position
+    for (
+      uint32_t iRank = 0;
+      iRank < nbNode;
+      ++iRank) {
+
+      store->rank[first + store->order[first + iRank]] = iRank;
+
+    }
+
+  }
+
+  // Memorize the ranked epochs
+  store->rankFromEpoch = fromEpoch;
+  if (fromEpochRank <= toEpoch) {
+
+    store->nbEpochRanked = toEpoch + 1;
+
+  }
+
+  // Free memory
+  RankSortBufferFree(&buffer);
+
+}
+
+// Rank the births of the runs of the GAViewer 'that' epoch by epoch,
+// only two epochs being in memory at once, and write the nodes of the
+// ranked epochs in rank order in the layout file of the runs
+// Return true if successfull, else false
+bool GAViewerRankOutOfCore(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (that->oocRuns == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that->oocRuns' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Display some info to the user
+  OocRuns* runs = that->oocRuns;
+  printf(
+    "Decoded %ld epochs\n",
+    that->nbEpoch);
+
+  // Get the range of ranked epochs, as GAViewerRankNodes, the runs
+  // holding no birth before the first one and after the last one
+  unsigned long fromEpoch = that->loadFromEpoch;
+  unsigned long nbEpochRanked = 0;
+  if (that->nbEpoch > fromEpoch) {
+
+    nbEpochRanked =
+      MIN(
+        that->toEpoch,
+        that->nbEpoch - 1) - fromEpoch + 1;
+
+  }
+
+  // Create the layout file and write its header, the nb of nodes being
+  // set once they are all written
+  FILE* streamLayout =
+    fopen(
+      runs->pathLayout,
+      "wb");
+  if (streamLayout == NULL) {
+
+    fprintf(
+      stderr,
+      "Couldn't create the layout [%s]\n",
+      runs->pathLayout);
+    return false;
+
+  }
+
+  GaoHeader header;
+  memset(
+    &header,
+    0,
+    sizeof(GaoHeader));
+  memcpy(
+    header.magic,
+    GAO_MAGIC,
+    4);
+  header.version = GAO_VERSION;
+  header.fromEpoch = fromEpoch;
+  header.nbEpoch = nbEpochRanked;
+  bool ret =
+    fwrite(
+      &header,
+      sizeof(GaoHeader),
+      1,
+      streamLayout) == 1;
+
+  // Streams of the runs opened at the first epoch of their births and
+  // closed after the last one, and their next birth
+  FILE** streams =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(FILE*) * MAX(runs->nbRun, 1));
+  NodeBirth* nexts =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(NodeBirth) * MAX(runs->nbRun, 1));
+  for (
+    int iRun = 0;
+    iRun < runs->nbRun;
+    ++iRun) {
+
+    streams[iRun] = NULL;
+
+  }
+
+  // Columns of the nodes of the current and previous epochs: id, rank
+  // by index, id of the father, index of the father in the previous
+  // epoch, index by rank and node in rank order, and hash table of the
+  // previous epoch retrieving its nodes from their id
+  uint32_t nbNodeAlloc = 0;
+  uint32_t* ids = NULL;
+  uint32_t* idsPrev = NULL;
+  uint32_t* ranks = NULL;
+  uint32_t* ranksPrev = NULL;
+  uint32_t* fathers = NULL;
+  uint32_t* fatherIdx = NULL;
+  uint32_t* order = NULL;
+  GaoNode* nodes = NULL;
+  uint64_t nbSlotAlloc = 0;
+  uint32_t* slots = NULL;
+  uint64_t maskPrev = 0;
+  uint32_t nbNodePrev = 0;
+  uint32_t nbNodeSort = 0;
+  RankSortBuffer buffer = RankSortBufferCreateStatic(0);
+
+  // Loop on the ranked epochs
+  for (
+    unsigned long jEpoch = 0;
+    jEpoch < nbEpochRanked && ret == true;
+    ++jEpoch) {
+
+    // Gather the births of this epoch from the runs holding some, in
+    // the order of the runs, which is the order of the history
+    unsigned long iEpoch = fromEpoch + jEpoch;
+    uint32_t nbNode = 0;
+    for (
+      int iRun = 0;
+      iRun < runs->nbRun && ret == true;
+      ++iRun) {
+
+      if (
+        runs->fromEpochs[iRun] > iEpoch ||
+        runs->toEpochs[iRun] < iEpoch) {
+
+        continue;
+
+      }
+
+      // Open the run at the first epoch of its births
+      if (streams[iRun] == NULL) {
+
+        char* path =
+          OocRunsGetPath(
+            runs,
+            iRun);
+        streams[iRun] =
+          fopen(
+            path,
+            "rb");
+        free(path);
+        ret =
+          streams[iRun] != NULL &&
+          fread(
+            nexts + iRun,
+            sizeof(NodeBirth),
+            1,
+            streams[iRun]) == 1;
+        if (ret == false) {
+
+          break;
+
+        }
+
+      }
+
+      // Read the births of this epoch
+      while (
+        streams[iRun] != NULL &&
+        nexts[iRun].epoch == iEpoch) {
+
+        // Grow the columns if necessary, doubling their size to
+        // amortize the reallocations
+        if (nbNode == nbNodeAlloc) {
+
+          if (nbNodeAlloc >= GAO_NOFATHER / 2) {
+
+            fprintf(
+              stderr,
+              "Too many nodes at epoch %lu\n",
+              iEpoch);
+            ret = false;
+            break;
+
+          }
+
+          nbNodeAlloc =
+            MAX(
+              1024,
+              2 * nbNodeAlloc);
+          uint32_t** columns[7] = {
+            &ids, &idsPrev, &ranks, &ranksPrev, &fathers, &fatherIdx, &order
+          };
+          for (
+            int iColumn = 0;
+            iColumn < 7;
+            ++iColumn) {
+
+            *(columns[iColumn]) =
+              realloc(
+                *(columns[iColumn]),
+                sizeof(uint32_t) * nbNodeAlloc);
+            if (*(columns[iColumn]) == NULL) {
+
+              GAViewerErr->_type = PBErrTypeMallocFailed;
+              sprintf(
+                GAViewerErr->_msg,
+                "Failed to allocate %u nodes",
+                nbNodeAlloc);
+              PBErrCatch(GAViewerErr);
+
+            }
+
+          }
+
+          nodes =
+            realloc(
+              nodes,
+              sizeof(GaoNode) * nbNodeAlloc);
+          if (nodes == NULL) {
+
+            GAViewerErr->_type = PBErrTypeMallocFailed;
+            sprintf(
+              GAViewerErr->_msg,
+              "Failed to allocate %u nodes",
+              nbNodeAlloc);
+            PBErrCatch(GAViewerErr);
+
+          }
+
+        }
+
+        // Add the birth, and move to the next one of the run, which
+        // is closed and removed once all its births are read
+        ids[nbNode] = nexts[iRun].id;
+        fathers[nbNode] = nexts[iRun].parents[0];
+        ++nbNode;
+        size_t nbRead =
+          fread(
+            nexts + iRun,
+            sizeof(NodeBirth),
+            1,
+            streams[iRun]);
+        if (nbRead != 1) {
+
+          fclose(streams[iRun]);
+          streams[iRun] = NULL;
+          char* path =
+            OocRunsGetPath(
+              runs,
+              iRun);
+          unlink(path);
+          free(path);
+
+        }
+
+      }
+
+    }
+
+    if (ret == false) {
+
+      break;
+
+    }
+
+    // Display some info to the user
+    printf(
+      "Number of nodes in epoch #%ld :%u\n",
+      iEpoch,
+      nbNode);
+
+    // The nodes of the first ranked epoch keep their order in the
+    // history and have no father
+    if (jEpoch == 0) {
+
+      for (
+        uint32_t iNode = 0;
+        iNode < nbNode;
+        ++iNode) {
+
+        order[iNode] = iNode;
+        fatherIdx[iNode] = NODE_NONE;
+
+      }
+
+    // Else, the nodes are sorted on the rank of their father, searched
+    // in the previous epoch
+    } else {
+
+      // Grow the buffers of the sort if necessary
+      uint32_t keyMax =
+        MAX(
+          nbNode,
+          nbNodePrev);
+      if (keyMax > nbNodeSort) {
+
+        RankSortBufferFree(&buffer);
+        nbNodeSort = keyMax;
+        buffer = RankSortBufferCreateStatic(nbNodeSort);
+
+      }
+
+      // If there is a father, the sort value of the node is the rank
+      // of the parent, else it's the nb of nodes in the epoch
+      for (
+        uint32_t iNode = 0;
+        iNode < nbNode;
+        ++iNode) {
+
+        uint32_t father = fathers[iNode];
+        uint64_t iSlot =
+          NodeIndexGetSlot(
+            father,
+            maskPrev);
+        STATS_ADD(nbSearch, 1);
+        STATS_ADD(nbCompare, 1);
+        while (
+          slots[iSlot] != NODE_NONE &&
+          idsPrev[slots[iSlot]] != father) {
+
+          iSlot = (iSlot + 1) & maskPrev;
+          STATS_ADD(nbCompare, 1);
+
+        }
+
+        fatherIdx[iNode] = slots[iSlot];
+        if (fatherIdx[iNode] != NODE_NONE) {
+
+          buffer.keys[iNode] = ranksPrev[fatherIdx[iNode]];
+
+        } else {
+
+          buffer.keys[iNode] = nbNode;
+
+        }
+
+      }
+
+      // Sort the nodes of the current epoch
+      RankSort(
+        &buffer,
+        nbNode,
+        keyMax,
+        ids,
+        order);
+
+    }
+
+    // Set the rank of the nodes to their position, and write them in
+    // rank order with the rank of their father
+    for (
+      uint32_t iRank = 0;
+      iRank < nbNode;
+      ++iRank) {
+
+      uint32_t iNode = order[iRank];
+      ranks[iNode] = iRank;
+      nodes[iRank].id = ids[iNode];
+      nodes[iRank].father = GAO_NOFATHER;
+      if (fatherIdx[iNode] != NODE_NONE) {
+
+        nodes[iRank].father = ranksPrev[fatherIdx[iNode]];
+        if (ids[iNode] == idsPrev[fatherIdx[iNode]]) {
+
+          nodes[iRank].father |= GAO_SURVIVE;
+
+        }
+
+      }
+
+    }
+
+    ret =
+      fwrite(
+        &nbNode,
+        sizeof(uint32_t),
+        1,
+        streamLayout) == 1 &&
+      fwrite(
+        nodes,
+        sizeof(GaoNode),
+        nbNode,
+        streamLayout) == nbNode;
+    header.nbNode += nbNode;
+
+    // Index the nodes of this epoch to search the fathers of the next
+    // one, keeping the first node with a given id, as GAViewerIndexNodes
+    uint64_t nbSlot = 1;
+    while (nbSlot < 2 * (uint64_t)nbNode) {
+
+      nbSlot <<= 1;
+
+    }
+
+    if (nbSlot > nbSlotAlloc) {
+
+      nbSlotAlloc = nbSlot;
+      free(slots);
+      slots =
+        PBErrMalloc(
+          GAViewerErr,
+          sizeof(uint32_t) * nbSlotAlloc);
+
+    }
+
+    maskPrev = nbSlot - 1;
+    for (
+      uint64_t iSlot = 0;
+      iSlot < nbSlot;
+      ++iSlot) {
+
+      slots[iSlot] = NODE_NONE;
+
+    }
+
+    for (
+      uint32_t iNode = 0;
+      iNode < nbNode;
+      ++iNode) {
+
+      uint64_t iSlot =
+        NodeIndexGetSlot(
+          ids[iNode],
+          maskPrev);
+      while (
+        slots[iSlot] != NODE_NONE &&
+        ids[slots[iSlot]] != ids[iNode]) {
+
+        iSlot = (iSlot + 1) & maskPrev;
+
+      }
+
+      if (slots[iSlot] == NODE_NONE) {
+
+        slots[iSlot] = iNode;
+
+      }
+
+    }
+
+    // The current epoch becomes the previous one
+    uint32_t* swap = ids;
+    ids = idsPrev;
+    idsPrev = swap;
+    swap = ranks;
+    ranks = ranksPrev;
+    ranksPrev = swap;
+    nbNodePrev = nbNode;
+
+  }
+
+  // Check all the births have been read back from the runs
+  if (
+    ret == true &&
+    header.nbNode != that->nbNode) {
+
+    fprintf(
+      stderr,
+      "The runs of births in [%s] are incomplete\n",
+      runs->dir);
+    ret = false;
+
+  }
+
+  // Update the nb of nodes in the header
+  if (ret == true) {
+
+    ret =
+      fseek(
+        streamLayout,
+        0,
+        SEEK_SET) == 0 &&
+      fwrite(
+        &header,
+        sizeof(GaoHeader),
+        1,
+        streamLayout) == 1;
+
+  }
+
+  ret = (fclose(streamLayout) == 0) && ret;
+  if (ret == false) {
+
+    fprintf(
+      stderr,
+      "Couldn't rank the nodes into the layout [%s]\n",
+      runs->pathLayout);
+
+  }
+
+  // Free memory
+  for (
+    int iRun = 0;
+    iRun < runs->nbRun;
+    ++iRun) {
+
+    if (streams[iRun] != NULL) {
+
+      fclose(streams[iRun]);
+
+    }
+
+  }
+
+  free(streams);
+  free(nexts);
+  free(ids);
+  free(idsPrev);
+  free(ranks);
+  free(ranksPrev);
+  free(fathers);
+  free(fatherIdx);
+  free(order);
+  free(nodes);
+  free(slots);
+  RankSortBufferFree(&buffer);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Comparison function of the RankKey, for qsort
+int GAViewerCmpKeys(
+  const void* a,
+  const void* b) {
+
+  const RankKey* keyA = a;
+  const RankKey* keyB = b;
+  if (keyA->key != keyB->key) {
+
+    return (keyA->key > keyB->key) - (keyA->key < keyB->key);
+
+  }
+
+  return (keyA->iNode > keyB->iNode) - (keyA->iNode < keyB->iNode);
+
+}
+
+// Create a static RankSortBuffer for epochs of up to 'nbNodeMax' nodes
+RankSortBuffer RankSortBufferCreateStatic(const uint64_t nbNodeMax) {
+
+  // Declare the new RankSortBuffer
+  RankSortBuffer that;
+
+  // Allocate the buffers, the counters being used for the keys up to
+  // nbNodeMax and for the 16 bits digits of the ids
+  that.keys =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint32_t) * MAX(nbNodeMax, 1));
+  that.tmp =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint32_t) * MAX(nbNodeMax, 1));
+  that.counts =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint32_t) *
+      MAX(
+        nbNodeMax + 1,
+        RANKSORT_NBDIGIT));
+
+  // Return the new RankSortBuffer
+  return that;
+
+}
+
+// Free the memory used by the RankSortBuffer 'that'
+void RankSortBufferFree(RankSortBuffer* const that) {
+
+  if (that == NULL) {
+
+    return;
+
+  }
+
+  free(that->keys);
+  free(that->tmp);
+  free(that->counts);
+  that->keys = NULL;
+  that->tmp = NULL;
+  that->counts = NULL;
+
+}
+
+// Sort the 'nbNode' nodes of sort keys 'that->keys', which are in
+// [0, keyMax], and of ids 'ids' by increasing key, then id, then index,
+// and set 'order' to the index of the nodes in that order
+void RankSort(
+  RankSortBuffer* const that,
+        const uint32_t nbNode,
+        const uint32_t keyMax,
+  const uint32_t* const ids,
+        uint32_t* const order) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (ids == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'ids' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (order == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'order' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Order the nodes by id into 'tmp' with a stable radix sort on the
+  // 16 bits digits of the ids, using 'order' as the intermediate
+  // buffer. The ids are usually already in increasing order in the
+  // history, in which case there is nothing to sort, and the high
+  // digits are sorted only if some ids need them
+  bool isSorted = true;
+  uint32_t idMax = 0;
+  for (
+    uint32_t iNode = 0;
+    iNode < nbNode;
+    ++iNode) {
+
+    if (
+      iNode > 0 &&
+      ids[iNode] < ids[iNode - 1]) {
+
+      isSorted = false;
+
+    }
+
+    idMax =
+      MAX(
+        idMax,
+        ids[iNode]);
+
+  }
+
+  uint32_t* counts = that->counts;
+  if (isSorted == true) {
+
+    for (
+      uint32_t iNode = 0;
+      iNode < nbNode;
+      ++iNode) {
+
+      that->tmp[iNode] = iNode;
+
+    }
+
+  } else {
+
+    int nbPass = (idMax >= RANKSORT_NBDIGIT ? 2 : 1);
+    for (
+      int iPass = 0;
+      iPass < nbPass;
+      ++iPass) {
+
+      // The last pass ends in 'tmp'
+      uint32_t* dest = (iPass == nbPass - 1 ? that->tmp : order);
+      int shift = 16 * iPass;
+      uint32_t nbDigit =
+        MIN(
+          (uint32_t)RANKSORT_NBDIGIT,
+          (idMax >> shift) + 1);
+      memset(
+        counts,
+        0,
+        sizeof(uint32_t) * nbDigit);
+      for (
+        uint32_t iNode = 0;
+        iNode < nbNode;
+        ++iNode) {
+
+        ++(counts[(ids[iNode] >> shift) & (RANKSORT_NBDIGIT - 1)]);
+
+      }
+
+      uint32_t sum = 0;
+      for (
+        uint32_t iDigit = 0;
+        iDigit < nbDigit;
+        ++iDigit) {
+
+        uint32_t count = counts[iDigit];
+        counts[iDigit] = sum;
+        sum += count;
+
+      }
+
+      for (
+        uint32_t iPos = 0;
+        iPos < nbNode;
+        ++iPos) {
+
+        uint32_t iNode = (iPass == 0 ? iPos : order[iPos]);
+        uint32_t digit = (ids[iNode] >> shift) & (RANKSORT_NBDIGIT - 1);
+        dest[counts[digit]] = iNode;
+        ++(counts[digit]);
+
+      }
+
+    }
+
+  }
+
+  // Stable counting sort of the nodes ordered by id on their keys
+  memset(
+    counts,
+    0,
+    sizeof(uint32_t) * ((size_t)keyMax + 1));
+  for (
+    uint32_t iNode = 0;
+    iNode < nbNode;
+    ++iNode) {
+
+    ++(counts[that->keys[iNode]]);
+
+  }
+
+  uint32_t sum = 0;
+  for (
+    uint32_t key = 0;
+    key <= keyMax;
+    ++key) {
+
+    uint32_t count = counts[key];
+    counts[key] = sum;
+    sum += count;
+
+  }
+
+  for (
+    uint32_t iPos = 0;
+    iPos < nbNode;
+    ++iPos) {
+
+    uint32_t iNode = that->tmp[iPos];
+    uint32_t key = that->keys[iNode];
+    order[counts[key]] = iNode;
+    ++(counts[key]);
+
+  }
+
+}
+
+// Run the benchmark of the sort of nodes with the comparison sort and
+// with RankSort for epochs of 10^3 up to 10^6 nodes
+void GAViewerBenchRank(void) {
+
+  printf("nbNode  qsort(s)  RankSort(s)  speedup\n");
+  srand(0);
+  for (
+    uint32_t nbNode = 1000;
+    nbNode <= 1000000;
+    nbNode *= 10) {
+
+    // Create an epoch where each node has a random father rank among
+    // as many nodes in the previous epoch, or no father, and shuffled
+    // ids
+    RankSortBuffer buffer = RankSortBufferCreateStatic(nbNode);
+    uint32_t* ids =
+      PBErrMalloc(
+        GAViewerErr,
+        sizeof(uint32_t) * nbNode);
+    uint32_t* order =
+      PBErrMalloc(
+        GAViewerErr,
+        sizeof(uint32_t) * nbNode);
+    RankKey* keys =
+      PBErrMalloc(
+        GAViewerErr,
+        sizeof(RankKey) * nbNode);
+    for (
+      uint32_t iNode = 0;
+      iNode < nbNode;
+      ++iNode) {
+
+      buffer.keys[iNode] = (uint32_t)rand() % (nbNode + 1);
+      ids[iNode] = (uint32_t)(((uint64_t)iNode * 7919) % nbNode) * 3;
+
+    }
+
+    // Measure the comparison sort
+    struct timespec start;
+    struct timespec stop;
+    clock_gettime(
+      CLOCK_MONOTONIC,
+      &start);
+    for (
+      uint32_t iNode = 0;
+      iNode < nbNode;
+      ++iNode) {
+
+      keys[iNode].key =
+        ((uint64_t)(buffer.keys[iNode]) << 32) | ids[iNode];
+      keys[iNode].iNode = iNode;
+
+    }
+
+    qsort(
+      keys,
+      nbNode,
+      sizeof(RankKey),
+      GAViewerCmpKeys);
+    clock_gettime(
+      CLOCK_MONOTONIC,
+      &stop);
+    double timeQsort =
+      (double)(stop.tv_sec - start.tv_sec) +
+      (double)(stop.tv_nsec - start.tv_nsec) * 1e-9;
+
+    // Measure RankSort
+    clock_gettime(
+      CLOCK_MONOTONIC,
+      &start);
+    RankSort(
+      &buffer,
+      nbNode,
+      nbNode,
+      ids,
+      order);
+    clock_gettime(
+      CLOCK_MONOTONIC,
+      &stop);
+    double timeRankSort =
+      (double)(stop.tv_sec - start.tv_sec) +
+      (double)(stop.tv_nsec - start.tv_nsec) * 1e-9;
+
+    // Check the two sorts give the same order
+    bool isSame = true;
+    for (
+      uint32_t iNode = 0;
+      iNode < nbNode;
+      ++iNode) {
+
+      if (keys[iNode].iNode != order[iNode]) {
+
+        isSame = false;
+
+      }
+
+    }
+
+    // Display the results
+    printf(
+      "%7u  %8.5f  %11.5f  x%.1f%s\n",
+      nbNode,
+      timeQsort,
+      timeRankSort,
+      (timeRankSort > 0.0 ? timeQsort / timeRankSort : 0.0),
+      (isSame == true ? "" : "  (different order)"));
+
+    // Free memory
+    RankSortBufferFree(&buffer);
+    free(ids);
+    free(order);
+    free(keys);
+
+  }
+
+}
+
+// Get the first slot probed for the id 'id' in a hash table of nodes
+// whose nb of slots is the power of 2 'mask' + 1. The slot is given by
+// the high bits of the multiplicative hash of the id, as its low bits
+// only depend on the low bits of the id
+static inline uint64_t NodeIndexGetSlot(
+  const uint32_t id,
+  const uint64_t mask) {
+
+  // The nb of leading zeros of the mask is 64 minus the nb of bits of
+  // the slots, the mask being at least 1 to keep the shift defined for
+  // a single slot
+  return
+    (((uint64_t)id * NODEINDEX_HASHMULT) >> __builtin_clzll(mask | 1)) &
+    mask;
+
+}
+
+// Create the index of the nodes at the epoch 'epoch'
+void GAViewerIndexNodes(
+  GAViewer* const that,
+    unsigned long epoch) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (epoch >= that->nodes.nbEpoch) {
+
+    GAViewerErr->_type = PBErrTypeInvalidArg;
+    sprintf(
+      GAViewerErr->_msg,
+      "'epoch' is invalid (%ld< %ld)",
+      epoch,
+      that->nodes.nbEpoch);
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Get the nodes and the hash table of this epoch
+  NodeStore* store = &(that->nodes);
+  uint64_t first = store->first[epoch];
+  uint32_t nbNode = store->first[epoch + 1] - first;
+  uint32_t* slots = store->slots + store->firstSlot[epoch];
+  uint64_t mask = store->firstSlot[epoch + 1] - store->firstSlot[epoch] - 1;
+
+  // Empty the slots
+  for (
+    uint64_t iSlot = 0;
+    iSlot <= mask;
+    ++iSlot) {
+
+    slots[iSlot] = NODE_NONE;
+
+  }
+
+  // Loop on the node of the epoch
+  for (
+    uint32_t iNode = 0;
+    iNode < nbNode;
+    ++iNode) {
+
+    // Probe the table from the slot given by the hash of the id until
+    // we find an empty slot or a node with the same id
+    uint32_t id = store->id[first + iNode];
+    uint64_t iSlot =
+      NodeIndexGetSlot(
+        id,
+        mask);
+    while (
+      slots[iSlot] != NODE_NONE &&
+      store->id[first + slots[iSlot]] != id) {
+
+      iSlot = (iSlot + 1) & mask;
+
+    }
+
+    // If the slot is empty, add the node. Else keep the first node
+    // with this id, as the linear search does
+    if (slots[iSlot] == NODE_NONE) {
+
+      slots[iSlot] = iNode;
+
+    }
+
+  }
+
+}
+
+// Search a node based on its id at a given epoch
+// Return the index of the node in its epoch, NODE_NONE if not found
+uint32_t GAViewerSearchNode(
+  const GAViewer* const that,
+          unsigned long epoch,
+          unsigned long id) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (epoch >= that->nodes.nbEpoch) {
+
+    GAViewerErr->_type = PBErrTypeInvalidArg;
+    sprintf(
+      GAViewerErr->_msg,
+      "'epoch' is invalid (%ld< %ld)",
+      epoch,
+      that->nodes.nbEpoch);
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Get the nodes and the hash table of this epoch
+  const NodeStore* store = &(that->nodes);
+  const uint32_t* ids = store->id + store->first[epoch];
+  const uint32_t* slots = store->slots + store->firstSlot[epoch];
+  uint64_t mask = store->firstSlot[epoch + 1] - store->firstSlot[epoch] - 1;
+
+  // Probe the table from the slot given by the hash of the id until
+  // we find the node or an empty slot
+  uint64_t iSlot =
+    NodeIndexGetSlot(
+      (uint32_t)id,
+      mask);
+  STATS_ADD(nbSearch, 1);
+  STATS_ADD(nbCompare, 1);
+  while (
+    slots[iSlot] != NODE_NONE &&
+    ids[slots[iSlot]] != id) {
+
+    iSlot = (iSlot + 1) & mask;
+    STATS_ADD(nbCompare, 1);
+
+  }
+
+  // Return the found node, NODE_NONE if there is no node with this id
+  return slots[iSlot];
+
+}
+
+// Search a node based on its id at a given epoch by scanning the whole
+// epoch, used as the reference for the indexed search
+// Return the index of the node in its epoch, NODE_NONE if not found
+uint32_t GAViewerSearchNodeLinear(
+  const GAViewer* const that,
+          unsigned long epoch,
+          unsigned long id) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (epoch >= that->nodes.nbEpoch) {
+
+    GAViewerErr->_type = PBErrTypeInvalidArg;
+    sprintf(
+      GAViewerErr->_msg,
+      "'epoch' is invalid (%ld< %ld)",
+      epoch,
+      that->nodes.nbEpoch);
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Get the nodes of this epoch
+  const NodeStore* store = &(that->nodes);
+  const uint32_t* ids = store->id + store->first[epoch];
+  uint32_t nbNode = store->first[epoch + 1] - store->first[epoch];
+
+  // Loop on the node of the epoch until we find the searched one
+  for (
+    uint32_t iNode = 0;
+    iNode < nbNode;
+    ++iNode) {
+
+    if (ids[iNode] == id) {
+
+      return iNode;
+
+    }
+
+  }
+
+  // The node wasn't found
+  return NODE_NONE;
+
+}
+
+// Create in 'index' the index of the edges from the nodes of the epochs
+// 'fromEpoch' + 1 to 'toEpoch' to their father and mother in the
+// previous epoch, and the reverse edges. The nodes of these epochs
+// must be ranked, as their fathers are the ones found by the ranking
+void GAViewerBuildEdgeIndex(
+  const GAViewer* const that,
+    const unsigned long fromEpoch,
+    const unsigned long toEpoch,
+       EdgeIndex* const index) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (index == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'index' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (
+    fromEpoch > toEpoch ||
+    toEpoch >= that->nodes.nbEpoch) {
+
+    GAViewerErr->_type = PBErrTypeInvalidArg;
+    sprintf(
+      GAViewerErr->_msg,
+      "the range of epochs is invalid (%lu, %lu)",
+      fromEpoch,
+      toEpoch);
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Allocate the offsets, the nodes having at most 2 parents
+  const NodeStore* store = &(that->nodes);
+  EdgeIndexFree(index);
+  index->fromEpoch = fromEpoch;
+  index->toEpoch = toEpoch;
+  index->firstNode = store->first[fromEpoch];
+  index->nbNode = store->first[toEpoch + 1] - index->firstNode;
+  index->parentFirst =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint64_t) * (index->nbNode + 1));
+  index->childFirst =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint64_t) * (index->nbNode + 1));
+  index->parents =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint32_t) * (2 * index->nbNode + 1));
+  memset(
+    index->childFirst,
+    0,
+    sizeof(uint64_t) * (index->nbNode + 1));
+
+  // Add the parents of the nodes, the nodes of the first epoch having
+  // none. The father is the one found by the ranking, and the mother
+  // is searched if she's not the father, and both are counted as
+  // children for their parent
+  uint64_t nbEdge = 0;
+  for (
+    unsigned long iEpoch = fromEpoch;
+    iEpoch <= toEpoch;
+    ++iEpoch) {
+
+    uint64_t first = store->first[iEpoch];
+    uint64_t firstPrev = (iEpoch > 0 ? store->first[iEpoch - 1] : 0);
+    for (
+      uint64_t iNode = first;
+      iNode < store->first[iEpoch + 1];
+      ++iNode) {
+
+      index->parentFirst[iNode - index->firstNode] = nbEdge;
+      if (iEpoch == fromEpoch) {
+
+        continue;
+
+      }
+
+      uint32_t father = store->fatherIdx[iNode];
+      if (father != NODE_NONE) {
+
+        index->parents[nbEdge] = father;
+        ++nbEdge;
+        ++(index->childFirst[firstPrev + father - index->firstNode]);
+
+      }
+
+      if (store->mother[iNode] != store->father[iNode]) {
+
+        uint32_t mother =
+          GAViewerSearchNode(
+            that,
+            iEpoch - 1,
+            store->mother[iNode]);
+        if (mother != NODE_NONE) {
+
+          index->parents[nbEdge] = mother;
+          ++nbEdge;
+          ++(index->childFirst[firstPrev + mother - index->firstNode]);
+
+        }
+
+      }
+
+    }
+
+  }
+
+  index->parentFirst[index->nbNode] = nbEdge;
+
+  // Turn the counts of children into offsets, then scatter the
+  // children of each parent in the order of the nodes
+  uint64_t offset = 0;
+  for (
+    uint64_t iNode = 0;
+    iNode <= index->nbNode;
+    ++iNode) {
+
+    uint64_t nbChild = index->childFirst[iNode];
+    index->childFirst[iNode] = offset;
+    offset += nbChild;
+
+  }
+
+  index->children =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint32_t) * (nbEdge + 1));
+  uint64_t* next =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint64_t) * (index->nbNode + 1));
+  memcpy(
+    next,
+    index->childFirst,
+    sizeof(uint64_t) * (index->nbNode + 1));
+  for (
+    unsigned long iEpoch = fromEpoch + 1;
+    iEpoch <= toEpoch;
+    ++iEpoch) {
+
+    uint64_t first = store->first[iEpoch];
+    uint64_t firstPrev = store->first[iEpoch - 1];
+    for (
+      uint64_t iNode = first;
+      iNode < store->first[iEpoch + 1];
+      ++iNode) {
+
+      for (
+        uint64_t iEdge = index->parentFirst[iNode - index->firstNode];
+        iEdge < index->parentFirst[iNode + 1 - index->firstNode];
+        ++iEdge) {
+
+        uint64_t parent = firstPrev + index->parents[iEdge];
+        index->children[next[parent - index->firstNode]] =
+          (uint32_t)(iNode - first);
+        ++(next[parent - index->firstNode]);
+
+      }
+
+    }
+
+  }
+
+  // Free memory
+  free(next);
+
+}
+
+// Trace the ancestors, or the descendants, of the node
+// 'that->traceId' at the epoch 'that->traceEpoch' over the loaded
+// epochs, print them per epoch and keep the bits of the traced nodes
+// to draw only them
+// Return true if successfull, else false
+bool GAViewerTrace(GAViewer* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // The lineage is traced over the ranked epochs, which are the loaded
+  // ones: the displayed epochs and the one before
+  const NodeStore* store = &(that->nodes);
+  unsigned long fromEpoch = store->rankFromEpoch;
+  unsigned long toEpoch = store->nbEpochRanked - 1;
+  if (
+    store->nbEpochRanked == 0 ||
+    that->traceEpoch < fromEpoch ||
+    that->traceEpoch > toEpoch) {
+
+    fprintf(
+      stderr,
+      "The epoch %lu of the traced node is not loaded\n",
+      that->traceEpoch);
+    return false;
+
+  }
+
+  uint32_t iNodeTrace =
+    GAViewerSearchNode(
+      that,
+      that->traceEpoch,
+      that->traceId);
+  if (iNodeTrace == NODE_NONE) {
+
+    fprintf(
+      stderr,
+      "There is no node %lu at the epoch %lu\n",
+      that->traceId,
+      that->traceEpoch);
+    return false;
+
+  }
+
+  // Create the index of the edges
+  double start = GAViewerGetTime();
+  EdgeIndex index = EdgeIndexCreateStatic();
+  GAViewerBuildEdgeIndex(
+    that,
+    fromEpoch,
+    toEpoch,
+    &index);
+  double timeIndex = GAViewerGetTime() - start;
+
+  // Mark the traced node, then from epoch to epoch the parents, or the
+  // children, of the marked nodes. The marked nodes of an epoch are
+  // found by skipping the null words of its bits, so the trace costs
+  // the nb of traced edges and a bit per node
+  start = GAViewerGetTime();
+  free(that->traceBits);
+  that->traceFirstNode = index.firstNode;
+  that->traceNbNode = index.nbNode;
+  size_t nbWord = (size_t)((index.nbNode + 63) / 64);
+  that->traceBits =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint64_t) * nbWord);
+  memset(
+    that->traceBits,
+    0,
+    sizeof(uint64_t) * nbWord);
+  uint64_t* bits = that->traceBits;
+  uint64_t bit = store->first[that->traceEpoch] + iNodeTrace - index.firstNode;
+  bits[bit / 64] |= (uint64_t)1 << (bit % 64);
+  unsigned long epochEnd =
+    (that->isTraceDescendants == true ? toEpoch : fromEpoch);
+  uint64_t nbTraced = 1;
+  unsigned long iEpoch = that->traceEpoch;
+  while (iEpoch != epochEnd) {
+
+    uint64_t nbMarked = 0;
+    uint64_t bitTo = store->first[iEpoch + 1] - index.firstNode;
+    bit = store->first[iEpoch] - index.firstNode;
+    while (bit < bitTo) {
+
+      // Skip to the next marked node of the epoch
+      uint64_t word = bits[bit / 64] >> (bit % 64);
+      if (word == 0) {
+
+        bit = (bit | 63) + 1;
+        continue;
+
+      }
+
+      bit += (uint64_t)__builtin_ctzll(word);
+      if (bit >= bitTo) {
+
+        break;
+
+      }
+
+      // Mark the parents or the children of the node
+      uint64_t firstNext =
+        (that->isTraceDescendants == true ?
+          store->first[iEpoch + 1] :
+          store->first[iEpoch - 1]) - index.firstNode;
+      const uint64_t* edgeFirst =
+        (that->isTraceDescendants == true ?
+          index.childFirst :
+          index.parentFirst);
+      const uint32_t* edges =
+        (that->isTraceDescendants == true ?
+          index.children :
+          index.parents);
+      for (
+        uint64_t iEdge = edgeFirst[bit];
+        iEdge < edgeFirst[bit + 1];
+        ++iEdge) {
+
+        uint64_t bitNext = firstNext + edges[iEdge];
+        uint64_t mask = (uint64_t)1 << (bitNext % 64);
+        if ((bits[bitNext / 64] & mask) == 0) {
+
+          bits[bitNext / 64] |= mask;
+          ++nbMarked;
+
+        }
+
+      }
+
+      ++bit;
+
+    }
+
+    // Stop when the lineage doesn't reach the next epoch
+    if (nbMarked == 0) {
+
+      break;
+
+    }
+
+    nbTraced += nbMarked;
+    if (that->isTraceDescendants == true) {
+
+      ++iEpoch;
+
+    } else {
+
+      --iEpoch;
+
+    }
+
+  }
+
+  double timeTrace = GAViewerGetTime() - start;
+
+  // Print the ids of the traced nodes per epoch, up to the last epoch
+  // reached by the lineage
+  unsigned long epochFrom =
+    (that->isTraceDescendants == true ? that->traceEpoch : iEpoch);
+  unsigned long epochTo =
+    (that->isTraceDescendants == true ? iEpoch : that->traceEpoch);
+  for (
+    unsigned long iEpoch = epochFrom;
+    iEpoch <= epochTo;
+    ++iEpoch) {
+
+    printf(
+      "epoch %lu:",
+      iEpoch);
+    for (
+      uint64_t iNode = store->first[iEpoch];
+      iNode < store->first[iEpoch + 1];
+      ++iNode) {
+
+      if (GAViewerIsTraced(that, iNode) == true) {
+
+        printf(
+          " %u",
+          store->id[iNode]);
+
+      }
+
+    }
+
+    printf("\n");
+
+  }
+
+  printf(
+    "Traced the %s of %lu@%lu: %lu nodes in %lu epochs in %.3fms " \
+    "(edge index of %lu edges built in %.3fms)\n",
+    (that->isTraceDescendants == true ? "descendants" : "ancestors"),
+    that->traceId,
+    that->traceEpoch,
+    (unsigned long)nbTraced,
+    epochTo - epochFrom + 1,
+    timeTrace * 1e3,
+    (unsigned long)(index.parentFirst[index.nbNode]),
+    timeIndex * 1e3);
+
+  // Free memory
+  EdgeIndexFree(&index);
+
+  // Return the success code
+  return true;
+
+}
+
+// Return true if the node 'iNode' is drawn, which is when no lineage is
+// traced or the node is in the traced lineage, else false
+static inline bool GAViewerIsTraced(
+  const GAViewer* const that,
+  const uint64_t iNode) {
+
+  if (that->traceBits == NULL) {
+
+    return true;
+
+  }
+
+  if (
+    iNode < that->traceFirstNode ||
+    iNode >= that->traceFirstNode + that->traceNbNode) {
+
+    return false;
+
+  }
+
+  uint64_t bit = iNode - that->traceFirstNode;
+  return ((that->traceBits[bit / 64] >> (bit % 64)) & 1) != 0;
+
+}
+
+// Run the benchmark of the search of nodes on a synthetic history
+// with 'nbNode' nodes per epoch
+void GAViewerBenchSearch(const unsigned long nbNode) {
+
+  // Create a viewer with two epochs of nodes with shuffled ids, each
+  // node at the second epoch has a random father in the first epoch
+  GAViewer* viewer = GAViewerCreate();
+  srand(0);
+  for (
+    unsigned long iEpoch = 0;
+    iEpoch < 2;
+    ++iEpoch) {
+
+    for (
+      unsigned long iNode = 0;
+      iNode < nbNode;
+      ++iNode) {
+
+      unsigned long father = (unsigned long)rand() % nbNode;
+      GAViewerAddNode(
+        viewer,
+        iEpoch,
+        father,
+        father,
+        (iNode * 7919) % nbNode + iEpoch * nbNode);
+
+    }
+
+  }
+
+  // Add the nodes to the columns
+  GAViewerBuildNodes(viewer);
+
+  // Measure the creation of the index
+  struct timespec start;
+  struct timespec stop;
+  clock_gettime(
+    CLOCK_MONOTONIC,
+    &start);
+  for (
+    unsigned long iEpoch = 0;
+    iEpoch < viewer->nbEpoch;
+    ++iEpoch) {
+
+    GAViewerIndexNodes(
+      viewer,
+      iEpoch);
+
+  }
+
+  clock_gettime(
+    CLOCK_MONOTONIC,
+    &stop);
+  double timeIndex =
+    (double)(stop.tv_sec - start.tv_sec) +
+    (double)(stop.tv_nsec - start.tv_nsec) * 1e-9;
+
+  // Measure the search of the father of each node of the second epoch,
+  // first with the linear search then with the index
+  double timeSearch[2] = {0.0, 0.0};
+  unsigned long nbFound[2] = {0, 0};
+  for (
+    int iMethod = 0;
+    iMethod < 2;
+    ++iMethod) {
+
+    clock_gettime(
+      CLOCK_MONOTONIC,
+      &start);
+    const NodeStore* store = &(viewer->nodes);
+    for (
+      uint64_t iNode = store->first[1];
+      iNode < store->first[2];
+      ++iNode) {
+
+      uint32_t father = NODE_NONE;
+      if (iMethod == 0) {
+
+        father =
+          GAViewerSearchNodeLinear(
+            viewer,
+            0,
+            store->father[iNode]);
+
+      } else {
+
+        father =
+          GAViewerSearchNode(
+            viewer,
+            0,
+            store->father[iNode]);
+
+      }
+
+      if (father != NODE_NONE) {
+
+        ++(nbFound[iMethod]);
+
+      }
+
+    }
+
+    clock_gettime(
+      CLOCK_MONOTONIC,
+      &stop);
+    timeSearch[iMethod] =
+      (double)(stop.tv_sec - start.tv_sec) +
+      (double)(stop.tv_nsec - start.tv_nsec) * 1e-9;
+
+  }
+
+  // Display the results
+  printf(
+    "Search of %lu fathers among %lu nodes\n",
+    nbNode,
+    nbNode);
+  printf(
+    "linear search: %fs (%lu found)\n",
+    timeSearch[0],
+    nbFound[0]);
+  printf(
+    "indexed search: %fs (%lu found) + %fs to create the index\n",
+    timeSearch[1],
+    nbFound[1],
+    timeIndex);
+  if (timeSearch[1] + timeIndex > 0.0) {
+
+    printf(
+      "speedup: x%.1f\n",
+      timeSearch[0] / (timeSearch[1] + timeIndex));
+
+  }
+
+  // Free memory
+  GAViewerFree(&viewer);
+
+}
+
+// Generate a synthetic history in the GenAlg format and save it at
+// 'path': 'nbEpoch' epochs of 'nbPop' individuals, the 'eliteRatio'
+// best ones surviving to the next epoch and the other ones being
+// replaced by children of the elites, a child taking the id of an
+// individual dead at the previous epoch with the probability 'idReuse'
+// instead of a new id
+// Return true if successfull, else false
+bool GAViewerGenHistory(
+  const char* const path,
+  const unsigned long nbEpoch,
+  const unsigned long nbPop,
+          const float eliteRatio,
+          const float idReuse) {
+
+#if BUILDMODE == 0
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  FILE* stream =
+    fopen(
+      path,
+      "w");
+  if (stream == NULL) {
+
+    return false;
+
+  }
+
+  // Nb of elites, at least one to have parents
+  unsigned long nbElite =
+    MAX(
+      (unsigned long)((float)nbPop * eliteRatio + 0.5f),
+      1);
+  nbElite =
+    MIN(
+      nbElite,
+      nbPop);
+
+  // Create the population of the first epoch, the individuals being
+  // their own parents as in GenAlg
+  GenIndiv* pop =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(GenIndiv) * nbPop);
+  unsigned long* deadIds =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(unsigned long) * nbPop);
+  srand(0);
+  unsigned long nextId = 0;
+  fprintf(
+    stream,
+    "{\"_genealogy\":[");
+  for (
+    unsigned long iIndiv = 0;
+    iIndiv < nbPop;
+    ++iIndiv) {
+
+    pop[iIndiv].id = nextId;
+    pop[iIndiv].fitness = rand();
+    ++nextId;
+    fprintf(
+      stream,
+      "%s{\"_epoch\":\"0\",\"_father\":\"%lu\",\"_mother\":\"%lu\"," \
+      "\"_id\":\"%lu\"}",
+      (iIndiv > 0 ? "," : ""),
+      pop[iIndiv].id,
+      pop[iIndiv].id,
+      pop[iIndiv].id);
+
+  }
+
+  // Loop on the following epochs
+  for (
+    unsigned long iEpoch = 1;
+    iEpoch < nbEpoch;
+    ++iEpoch) {
+
+    // Sort the population of the previous epoch, the elites survive
+    // and are written first as in GenAlg, and the other ones die
+    qsort(
+      pop,
+      nbPop,
+      sizeof(GenIndiv),
+      GenIndivCmp);
+    for (
+      unsigned long iIndiv = 0;
+      iIndiv < nbElite;
+      ++iIndiv) {
+
+      fprintf(
+        stream,
+        ",{\"_epoch\":\"%lu\",\"_father\":\"%lu\",\"_mother\":\"%lu\"," \
+        "\"_id\":\"%lu\"}",
+        iEpoch,
+        pop[iIndiv].id,
+        pop[iIndiv].id,
+        pop[iIndiv].id);
+
+    }
+
+    // Replace the dead individuals by children of two elites, chosen
+    // with a bias towards the best ones. The ids of the dead are taken
+    // in order, so a reused id is never taken twice in an epoch
+    for (
+      unsigned long iIndiv = nbElite;
+      iIndiv < nbPop;
+      ++iIndiv) {
+
+      deadIds[iIndiv] = pop[iIndiv].id;
+
+    }
+
+    unsigned long iDead = nbElite;
+    for (
+      unsigned long iIndiv = nbElite;
+      iIndiv < nbPop;
+      ++iIndiv) {
+
+      unsigned long parents[2];
+      for (
+        int iParent = 0;
+        iParent < 2;
+        ++iParent) {
+
+        float u = (float)rand() / ((float)RAND_MAX + 1.0f);
+        parents[iParent] = pop[(unsigned long)(u * u * (float)nbElite)].id;
+
+      }
+
+      unsigned long id = nextId;
+      if ((float)rand() / ((float)RAND_MAX + 1.0f) < idReuse) {
+
+        id = deadIds[iDead];
+        ++iDead;
+
+      } else {
+
+        ++nextId;
+
+      }
+
+      fprintf(
+        stream,
+        ",{\"_epoch\":\"%lu\",\"_father\":\"%lu\",\"_mother\":\"%lu\"," \
+        "\"_id\":\"%lu\"}",
+        iEpoch,
+        parents[0],
+        parents[1],
+        id);
+
+      pop[iIndiv].id = id;
+      pop[iIndiv].fitness = rand();
+
+    }
+
+  }
+
+  fprintf(
+    stream,
+    "]}\n");
+  bool ret = (ferror(stream) == 0);
+  ret = (fclose(stream) == 0) && ret;
+
+  // Free memory
+  free(pop);
+  free(deadIds);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Comparison function of the GenIndiv, for qsort, by decreasing
+// fitness then increasing id
+int GenIndivCmp(
+  const void* a,
+  const void* b) {
+
+  const GenIndiv* indivA = a;
+  const GenIndiv* indivB = b;
+  if (indivA->fitness != indivB->fitness) {
+
+    return (indivA->fitness > indivB->fitness ? -1 : 1);
+
+  }
+
+  return (indivA->id < indivB->id ? -1 : (indivA->id > indivB->id ? 1 : 0));
+
+}
+
+// Run the benchmark of the phases of the conversion of a history into
+// an image (parse, node conversion, ranking, rendering with the direct
+// renderer and save) on synthetic histories of increasing size, with
+// 'nbThread' threads, and save the results as CSV at 'path'
+// Return true if successfull, else false
+bool GAViewerBenchPhases(
+  const char* const path,
+          const int nbThread) {
+
+#if BUILDMODE == 0
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  FILE* streamCsv =
+    fopen(
+      path,
+      "w");
+  if (streamCsv == NULL) {
+
+    fprintf(
+      stderr,
+      "Couldn't open the results file [%s]\n",
+      path);
+    return false;
+
+  }
+
+  fprintf(
+    streamCsv,
+    "nbEpoch,nbPop,nbBirth,nbThread,width,height," \
+    "parse,build,rank,render,save\n");
+
+  // The synthetic history and its image are saved beside the results
+  char* pathHistory =
+    PBErrMalloc(
+      GAViewerErr,
+      strlen(path) + 16);
+  sprintf(
+    pathHistory,
+    "%s.json",
+    path);
+  char* pathImg =
+    PBErrMalloc(
+      GAViewerErr,
+      strlen(path) + 16);
+  sprintf(
+    pathImg,
+    "%s.png",
+    path);
+
+  // Loop on the sizes of the history, 100 epochs of 10^3 to 10^5
+  // individuals with 10% of elites and half of the children reusing
+  // the id of a dead individual
+  int width = 1920;
+  int height = 1080;
+  unsigned long nbEpoch = 100;
+  bool ret = true;
+  for (
+    unsigned long nbPop = 1000;
+    nbPop <= 100000 && ret == true;
+    nbPop *= 10) {
+
+    ret =
+      GAViewerGenHistory(
+        pathHistory,
+        nbEpoch,
+        nbPop,
+        0.1f,
+        0.5f);
+    if (ret == false) {
+
+      fprintf(
+        stderr,
+        "Couldn't generate the history [%s]\n",
+        pathHistory);
+      break;
+
+    }
+
+    GAViewer* viewer = GAViewerCreate();
+    viewer->nbThread = nbThread;
+    viewer->renderer = GAViewerRendererDirect;
+    double times[5] = {0.0};
+
+    // Measure the parse of the births
+    FILE* stream =
+      fopen(
+        pathHistory,
+        "rb");
+    double start = GAViewerGetTime();
+    ret =
+      stream != NULL &&
+      GAViewerLoadHistory(
+        viewer,
+        stream);
+    times[0] = GAViewerGetTime() - start;
+    if (stream != NULL) {
+
+      fclose(stream);
+
+    }
+
+    // Measure the conversion of the births into nodes
+    start = GAViewerGetTime();
+    GAViewerBuildNodes(viewer);
+    times[1] = GAViewerGetTime() - start;
+
+    // Measure the ranking of all the epochs
+    viewer->fromEpoch = 0;
+    viewer->toEpoch = viewer->nbEpoch - 1;
+    start = GAViewerGetTime();
+    if (ret == true) {
+
+      GAViewerRankNodes(viewer);
+
+    }
+
+    times[2] = GAViewerGetTime() - start;
+
+    // Measure the rendering
+    Raster raster =
+      RasterCreateStatic(
+        width,
+        height);
+    start = GAViewerGetTime();
+    RasterFill(
+      &raster,
+      RASTER_RGBA(255, 255, 255, 255));
+    if (ret == true) {
+
+      if (nbThread > 1) {
+
+        GAViewerDrawHistoryTiled(
+          viewer,
+          &raster);
+
+      } else {
+
+        GAViewerDrawHistory(
+          viewer,
+          &raster);
+
+      }
+
+    }
+
+    times[3] = GAViewerGetTime() - start;
+
+    // Measure the save of the image
+    start = GAViewerGetTime();
+    ret =
+      ret &&
+      RasterSave(
+        &raster,
+        pathImg,
+        ImgFormatPng,
+        nbThread);
+    times[4] = GAViewerGetTime() - start;
+
+    // Save the results
+    if (ret == true) {
+
+      fprintf(
+        streamCsv,
+        "%lu,%lu,%lu,%d,%d,%d,%.6f,%.6f,%.6f,%.6f,%.6f\n",
+        nbEpoch,
+        nbPop,
+        viewer->nbNode,
+        nbThread,
+        width,
+        height,
+        times[0],
+        times[1],
+        times[2],
+        times[3],
+        times[4]);
+      printf(
+        "%lu births: parse %.3fs, build %.3fs, rank %.3fs, " \
+        "render %.3fs, save %.3fs\n",
+        viewer->nbNode,
+        times[0],
+        times[1],
+        times[2],
+        times[3],
+        times[4]);
+
+    } else {
+
+      fprintf(
+        stderr,
+        "Couldn't convert the history [%s]\n",
+        pathHistory);
+
+    }
+
+    // Free memory
+    RasterFree(&raster);
+    GAViewerFree(&viewer);
+
+  }
+
+  // Remove the synthetic history and its image
+  remove(pathHistory);
+  remove(pathImg);
+  ret = (fclose(streamCsv) == 0) && ret;
+  if (ret == true) {
+
+    printf(
+      "Saved the results [%s]\n",
+      path);
+
+  }
+
+  // Free memory
+  free(pathHistory);
+  free(pathImg);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Get the time in seconds of the monotonic clock
+double GAViewerGetTime(void) {
+
+  struct timespec time;
+  clock_gettime(
+    CLOCK_MONOTONIC,
+    &time);
+  return (double)(time.tv_sec) + (double)(time.tv_nsec) * 1e-9;
+
+}
+
+// Create a static empty NodeStore
+NodeStore NodeStoreCreateStatic(void) {
+
+  // Declare the new NodeStore
+  NodeStore that;
+
+  // Init the properties
+  that.births = NULL;
+  that.nbBirth = 0;
+  that.nbBirthAlloc = 0;
+  that.arena = NULL;
+  that.map = NULL;
+  that.mapSize = 0;
+  that.nbNode = 0;
+  that.nbEpoch = 0;
+  that.nbNodeAlloc = 0;
+  that.nbEpochAlloc = 0;
+  that.nbSlotAlloc = 0;
+  that.rankFromEpoch = 0;
+  that.nbEpochRanked = 0;
+  that.first = NULL;
+  that.id = NULL;
+  that.father = NULL;
+  that.mother = NULL;
+  that.rank = NULL;
+  that.order = NULL;
+  that.fatherIdx = NULL;
+  that.firstSlot = NULL;
+  that.slots = NULL;
+
+  // Return the new NodeStore
+  return that;
+
+}
+
+// Free the memory used by the NodeStore 'that', which becomes empty
+void NodeStoreFree(NodeStore* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Free memory
+  free(that->births);
+  free(that->arena);
+  if (that->map != NULL) {
+
+    munmap(
+      that->map,
+      that->mapSize);
+
+  }
+
+  // Reset the store
+  *that = NodeStoreCreateStatic();
+
+}
+
+// Create a static empty EpochIndex
+EpochIndex EpochIndexCreateStatic(void) {
+
+  // Declare the new EpochIndex
+  EpochIndex that;
+
+  // Init the properties
+  that.offsets = NULL;
+  that.nbBirthEpoch = NULL;
+  that.nbBirth = 0;
+  that.maxId = 0;
+  that.nbEpoch = 0;
+  that.nbEpochAlloc = 0;
+  that.isSorted = true;
+
+  // Return the new EpochIndex
+  return that;
+
+}
+
+// Free the memory used by the EpochIndex 'that', which becomes empty
+void EpochIndexFree(EpochIndex* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Free memory and reset the index
+  free(that->offsets);
+  free(that->nbBirthEpoch);
+  *that = EpochIndexCreateStatic();
+
+}
+
+// Add the birth of 'id' at offset 'offset' in the history file, for
+// the epoch 'epoch', to the EpochIndex 'that'
+void EpochIndexAddBirth(
+  EpochIndex* const that,
+    unsigned long epoch,
+   const uint64_t offset,
+    unsigned long id) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // If the birth is in an epoch before the last indexed one, the
+  // births are not grouped by increasing epoch
+  if (epoch + 1 < that->nbEpoch) {
+
+    that->isSorted = false;
+
+  }
+
+  // Add the epochs up to the one of the birth, epochs without births
+  // start where the next epoch starts
+  while (that->nbEpoch <= epoch) {
+
+    if (that->nbEpoch == that->nbEpochAlloc) {
+
+      that->nbEpochAlloc =
+        MAX(
+          256,
+          2 * that->nbEpochAlloc);
+      that->offsets =
+        realloc(
+          that->offsets,
+          sizeof(uint64_t) * that->nbEpochAlloc);
+      that->nbBirthEpoch =
+        realloc(
+          that->nbBirthEpoch,
+          sizeof(uint64_t) * that->nbEpochAlloc);
+      if (
+        that->offsets == NULL ||
+        that->nbBirthEpoch == NULL) {
+
+        GAViewerErr->_type = PBErrTypeMallocFailed;
+        sprintf(
+          GAViewerErr->_msg,
+          "Failed to allocate %lu epochs",
+          that->nbEpochAlloc);
+        PBErrCatch(GAViewerErr);
+
+      }
+
+    }
+
+    that->offsets[that->nbEpoch] = offset;
+    that->nbBirthEpoch[that->nbEpoch] = 0;
+    ++(that->nbEpoch);
+
+  }
+
+  // Update the summary
+  ++(that->nbBirthEpoch[epoch]);
+  ++(that->nbBirth);
+  that->maxId =
+    MAX(
+      that->maxId,
+      id);
+
+}
+
+// Create the runs of births of the out-of-core mode in the directory
+// 'dir', created if necessary
+// Return the new OocRuns, NULL if the directory couldn't be created
+OocRuns* OocRunsCreate(const char* const dir) {
+
+#if BUILDMODE == 0
+  if (dir == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'dir' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Create the directory if necessary
+  if (GAViewerMakeDir(dir) == false) {
+
+    return NULL;
+
+  }
+
+  // Allocate memory for the new OocRuns
+  OocRuns* that =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(OocRuns));
+
+  // Set the properties, the files being named after the process so
+  // several viewers can share the directory
+  that->dir = strdup(dir);
+  that->pathLayout =
+    PBErrMalloc(
+      GAViewerErr,
+      strlen(dir) + 64);
+  sprintf(
+    that->pathLayout,
+    "%s/gaviewer.%ld%s",
+    dir,
+    (long)getpid(),
+    GAO_EXT);
+  that->births =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(NodeBirth) * OOC_NBBIRTHRUN);
+  that->keys =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(RankKey) * OOC_NBBIRTHRUN);
+  that->nbBirth = 0;
+  that->nbRun = 0;
+  that->fromEpochs = NULL;
+  that->toEpochs = NULL;
+
+  // Return the new OocRuns
+  return that;
+
+}
+
+// Free the memory used by the OocRuns 'that' and remove its files
+void OocRunsFree(OocRuns** const that) {
+
+  if (that == NULL || *that == NULL) return;
+
+  // Remove the run files which haven't been merged yet, and the layout
+  // file
+  for (
+    int iRun = 0;
+    iRun < (*that)->nbRun;
+    ++iRun) {
+
+    char* path =
+      OocRunsGetPath(
+        *that,
+        iRun);
+    unlink(path);
+    free(path);
+
+  }
+
+  unlink((*that)->pathLayout);
+
+  // Free memory
+  free((*that)->dir);
+  free((*that)->pathLayout);
+  free((*that)->births);
+  free((*that)->keys);
+  free((*that)->fromEpochs);
+  free((*that)->toEpochs);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Get the path of the run file 'iRun' of the OocRuns 'that'
+// Return a newly allocated string
+char* OocRunsGetPath(
+  const OocRuns* const that,
+             const int iRun) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  char* path =
+    PBErrMalloc(
+      GAViewerErr,
+      strlen(that->dir) + 64);
+  sprintf(
+    path,
+    "%s/gaviewer.%ld.%d.run",
+    that->dir,
+    (long)getpid(),
+    iRun);
+  return path;
+
+}
+
+// Add the birth 'birth' to the OocRuns 'that', writing the buffered
+// births as a new run when the buffer is full
+// Return true if successfull, else false
+bool OocRunsAddBirth(
+          OocRuns* const that,
+  const NodeBirth* const birth) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (birth == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'birth' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // If the buffer is full, write it as a new run
+  if (that->nbBirth == OOC_NBBIRTHRUN) {
+
+    bool ret = OocRunsFlush(that);
+    if (ret == false) {
+
+      return false;
+
+    }
+
+  }
+
+  // Add the birth to the buffer
+  that->births[that->nbBirth] = *birth;
+  ++(that->nbBirth);
+
+  // Return the success code
+  return true;
+
+}
+
+// Write the buffered births of the OocRuns 'that' as a new run, sorted
+// by epoch
+// Return true if successfull, else false
+bool OocRunsFlush(OocRuns* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // If there is no buffered birth, there is nothing to write
+  if (that->nbBirth == 0) {
+
+    return true;
+
+  }
+
+  // Sort the births by epoch, keeping the order of the history inside
+  // an epoch, unless they are already sorted as usual
+  bool isSorted = true;
+  for (
+    uint64_t iBirth = 0;
+    iBirth < that->nbBirth;
+    ++iBirth) {
+
+    that->keys[iBirth].key = that->births[iBirth].epoch;
+    that->keys[iBirth].iNode = iBirth;
+    if (
+      iBirth > 0 &&
+      that->births[iBirth].epoch < that->births[iBirth - 1].epoch) {
+
+      isSorted = false;
+
+    }
+
+  }
+
+  if (isSorted == false) {
+
+    qsort(
+      that->keys,
+      that->nbBirth,
+      sizeof(RankKey),
+      GAViewerCmpKeys);
+
+  }
+
+  // Open the run file
+  char* path =
+    OocRunsGetPath(
+      that,
+      that->nbRun);
+  FILE* stream =
+    fopen(
+      path,
+      "wb");
+  if (stream == NULL) {
+
+    fprintf(
+      stderr,
+      "Couldn't create the run of births [%s]\n",
+      path);
+    free(path);
+    return false;
+
+  }
+
+  // Write the births in epoch order
+  bool ret = true;
+  for (
+    uint64_t iBirth = 0;
+    iBirth < that->nbBirth && ret == true;
+    ++iBirth) {
+
+    ret =
+      fwrite(
+        that->births + that->keys[iBirth].iNode,
+        sizeof(NodeBirth),
+        1,
+        stream) == 1;
+
+  }
+
+  ret = (fclose(stream) == 0) && ret;
+  if (ret == false) {
+
+    fprintf(
+      stderr,
+      "Couldn't write the run of births [%s]\n",
+      path);
+    unlink(path);
+    free(path);
+    return false;
+
+  }
+
+  free(path);
+
+  // Memorize the range of epochs of the run
+  that->fromEpochs =
+    realloc(
+      that->fromEpochs,
+      sizeof(uint32_t) * (that->nbRun + 1));
+  that->toEpochs =
+    realloc(
+      that->toEpochs,
+      sizeof(uint32_t) * (that->nbRun + 1));
+  if (that->fromEpochs == NULL || that->toEpochs == NULL) {
+
+    GAViewerErr->_type = PBErrTypeMallocFailed;
+    sprintf(
+      GAViewerErr->_msg,
+      "Failed to allocate %d runs",
+      that->nbRun + 1);
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  that->fromEpochs[that->nbRun] =
+    that->births[that->keys[0].iNode].epoch;
+  that->toEpochs[that->nbRun] =
+    that->births[that->keys[that->nbBirth - 1].iNode].epoch;
+  ++(that->nbRun);
+
+  // Empty the buffer
+  that->nbBirth = 0;
+
+  // Return the success code
+  return true;
+
+}
+
+// Create a static empty LayoutCache
+LayoutCache LayoutCacheCreateStatic(void) {
+
+  // Declare the new LayoutCache
+  LayoutCache that;
+
+  // Init the properties
+  that.fromEpoch = 0;
+  that.nbEpoch = 0;
+  that.first = NULL;
+  that.rank = NULL;
+  that.fatherIdx = NULL;
+  that.checkpoints = NULL;
+  that.nbCheckpoint = 0;
+
+  // Return the new LayoutCache
+  return that;
+
+}
+
+// Free the memory used by the LayoutCache 'that', which becomes empty
+void LayoutCacheFree(LayoutCache* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Free memory and reset the cache
+  free(that->first);
+  free(that->rank);
+  free(that->fatherIdx);
+  free(that->checkpoints);
+  *that = LayoutCacheCreateStatic();
+
+}
+
+// Create a static empty EdgeIndex
+EdgeIndex EdgeIndexCreateStatic(void) {
+
+  // Declare the new EdgeIndex
+  EdgeIndex that;
+
+  // Init the properties
+  that.fromEpoch = 0;
+  that.toEpoch = 0;
+  that.firstNode = 0;
+  that.nbNode = 0;
+  that.parentFirst = NULL;
+  that.parents = NULL;
+  that.childFirst = NULL;
+  that.children = NULL;
+
+  // Return the new EdgeIndex
+  return that;
+
+}
+
+// Free the memory used by the EdgeIndex 'that', which becomes empty
+void EdgeIndexFree(EdgeIndex* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Free memory and reset the index
+  free(that->parentFirst);
+  free(that->parents);
+  free(that->childFirst);
+  free(that->children);
+  *that = EdgeIndexCreateStatic();
+
+}
+
+// Kernels for each instruction set
+static const RasterKernels rasterKernelsScalar = {
+  "scalar",
+  RasterDrawDiscScalar,
+  RasterDrawCurveScalar,
+  RasterAccumulateRowScalar
+};
+#if RASTER_SIMD_X86
+static const RasterKernels rasterKernelsSSE2 = {
+  "sse2",
+  RasterDrawDiscSSE2,
+  RasterDrawCurveSSE2,
+  RasterAccumulateRowSSE2
+};
+static const RasterKernels rasterKernelsAVX2 = {
+  "avx2",
+  RasterDrawDiscAVX2,
+  RasterDrawCurveAVX2,
+  RasterAccumulateRowAVX2
+};
+#endif
+
+// Create a static Raster of 'width' x 'height' pixels
+Raster RasterCreateStatic(
+  const int width,
+  const int height) {
+
+#if BUILDMODE == 0
+  if (
+    width <= 0 ||
+    height <= 0) {
+
+    GAViewerErr->_type = PBErrTypeInvalidArg;
+    sprintf(
+      GAViewerErr->_msg,
+      "Invalid dimensions (%dx%d)",
+      width,
+      height);
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Declare the new Raster
+  Raster that;
+
+  // Set the properties
+  that.width = width;
+  that.height = height;
+  that.pixels =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint32_t) * (size_t)width * (size_t)height);
+  that.widthImg = width;
+  that.heightImg = height;
+  that.originX = 0;
+  that.originY = 0;
+  that.xMin = 0;
+  that.xMax = width - 1;
+  that.yMin = 0;
+  that.yMax = height - 1;
+
+  // Select the best kernels if they are not selected yet, here rather
+  // than when drawing as the drawing may be done by several threads
+  if (rasterKernels == NULL) {
+
+    RasterSelectKernels(RasterGetKernels("auto"));
+
+  }
+
+  // Return the new Raster
+  return that;
+
+}
+
+// Free the memory used by the Raster 'that'
+void RasterFree(Raster* const that) {
+
+  if (that == NULL) {
+
+    return;
+
+  }
+
+  free(that->pixels);
+  that->pixels = NULL;
+  that->width = 0;
+  that->height = 0;
+
+}
+
+// Fill the clipped columns and rows of the Raster 'that' with the color
+// 'color'
+void RasterFill(
+    Raster* const that,
+  const uint32_t color) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  for (
+    int y = that->yMin;
+    y <= that->yMax;
+    ++y) {
+
+    uint32_t* row =
+      that->pixels +
+      (size_t)(y - that->originY) * (size_t)(that->width) -
+      that->originX;
+    for (
+      int x = that->xMin;
+      x <= that->xMax;
+      ++x) {
+
+      row[x] = color;
+
+    }
+
+  }
+
+}
+
+// Set the pixel at ('x', 'y') of the Raster 'that' to 'color' if it's
+// inside its clipped columns and rows
+static inline void RasterPlot(
+    Raster* const that,
+       const int x,
+       const int y,
+  const uint32_t color) {
+
+  if (
+    x >= that->xMin &&
+    y >= that->yMin &&
+    x <= that->xMax &&
+    y <= that->yMax) {
+
+    that->pixels[
+      (size_t)(y - that->originY) * (size_t)(that->width) +
+      (size_t)(x - that->originX)] = color;
+    STATS_ADD(nbPixel, 1);
+
+  }
+
+}
+
+// Draw the vertical line at 'x' from 'yMin' to 'yMax' in the Raster
+// 'that' with the color 'color'
+void RasterDrawVLine(
+    Raster* const that,
+     const float x,
+     const float yMin,
+     const float yMax,
+  const uint32_t color) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  int ix = (int)roundf(x);
+  int iyTo =
+    MIN(
+      (int)floorf(yMax),
+      that->yMax);
+  for (
+    int iy =
+      MAX(
+        (int)floorf(yMin),
+        that->yMin);
+    iy <= iyTo;
+    ++iy) {
+
+    RasterPlot(
+      that,
+      ix,
+      iy,
+      color);
+
+  }
+
+}
+
+// Draw the filled disc of center ('x', 'y') and radius 'radius' in the
+// Raster 'that' with the color 'color', using the selected kernels
+void RasterDrawDisc(
+    Raster* const that,
+     const float x,
+     const float y,
+     const float radius,
+  const uint32_t color) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Skip the disc if it's outside the clipped columns or rows
+  if (
+    x + radius + 1.0f < (float)(that->xMin) ||
+    x - radius - 1.0f > (float)(that->xMax + 1) ||
+    y + radius + 1.0f < (float)(that->yMin) ||
+    y - radius - 1.0f > (float)(that->yMax + 1)) {
+
+    return;
+
+  }
+
+  STATS_ADD(nbShapoid, 1);
+  rasterKernels->drawDisc(
+    that,
+    x,
+    y,
+    radius,
+    color);
+
+}
+
+// Draw the 1 pixel wide cubic Bezier curve of control points 'ctrl'
+// (x0, y0, x1, y1, x2, y2, x3, y3) in the Raster 'that' with the color
+// 'color', using the selected kernels
+void RasterDrawCurve(
+     Raster* const that,
+  const float* const ctrl,
+      const uint32_t color) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (ctrl == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'ctrl' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Skip the curve if it's outside the clipped columns or rows, the
+  // curve being inside the hull of its control points
+  float xMinCtrl = ctrl[0];
+  float xMaxCtrl = ctrl[0];
+  float yMinCtrl = ctrl[1];
+  float yMaxCtrl = ctrl[1];
+  for (
+    int iCtrl = 1;
+    iCtrl < 4;
+    ++iCtrl) {
+
+    xMinCtrl =
+      MIN(
+        xMinCtrl,
+        ctrl[2 * iCtrl]);
+    xMaxCtrl =
+      MAX(
+        xMaxCtrl,
+        ctrl[2 * iCtrl]);
+    yMinCtrl =
+      MIN(
+        yMinCtrl,
+        ctrl[2 * iCtrl + 1]);
+    yMaxCtrl =
+      MAX(
+        yMaxCtrl,
+        ctrl[2 * iCtrl + 1]);
+
+  }
+
+  if (
+    xMaxCtrl + 1.0f < (float)(that->xMin) ||
+    xMinCtrl - 1.0f > (float)(that->xMax + 1) ||
+    yMaxCtrl + 1.0f < (float)(that->yMin) ||
+    yMinCtrl - 1.0f > (float)(that->yMax + 1)) {
+
+    return;
+
+  }
+
+  STATS_ADD(nbCurve, 1);
+  rasterKernels->drawCurve(
+    that,
+    ctrl,
+    color);
+
+}
+
+// Get the kernels for the instruction set 'name' (scalar, sse2, avx2,
+// or auto for the best one supported by the CPU)
+// Return NULL if the instruction set is unknown or not supported
+const RasterKernels* RasterGetKernels(const char* const name) {
+
+#if BUILDMODE == 0
+  if (name == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'name' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  bool isAuto =
+    (strcmp(
+      name,
+      "auto") == 0);
+
+#if RASTER_SIMD_X86
+  __builtin_cpu_init();
+  if (
+    (isAuto == true ||
+    strcmp(
+      name,
+      "avx2") == 0) &&
+    __builtin_cpu_supports("avx2")) {
+
+    return &rasterKernelsAVX2;
+
+  }
+
+  if (
+    (isAuto == true ||
+    strcmp(
+      name,
+      "sse2") == 0) &&
+    __builtin_cpu_supports("sse2")) {
+
+    return &rasterKernelsSSE2;
+
+  }
+
+#endif
+
+  if (
+    isAuto == true ||
+    strcmp(
+      name,
+      "scalar") == 0) {
+
+    return &rasterKernelsScalar;
+
+  }
+
+  return NULL;
+
+}
+
+// Select the kernels used by RasterDrawDisc and RasterDrawCurve
+void RasterSelectKernels(const RasterKernels* const kernels) {
+
+#if BUILDMODE == 0
+  if (kernels == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'kernels' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  rasterKernels = kernels;
+
+}
+
+// Get the nb of samples used to flatten the curve of control points
+// 'ctrl', about one every half pixel along its control polygon
+int RasterGetNbSampleCurve(const float* const ctrl) {
+
+  // Consecutive samples are then less than half a pixel apart, so
+  // plotting the nearest pixel of each sample gives a connected line
+  // which follows closely the curves drawn by GenBrush
+  float length = 0.0f;
+  for (
+    int iCtrl = 0;
+    iCtrl < 3;
+    ++iCtrl) {
+
+    length +=
+      fabsf(ctrl[2 * iCtrl + 2] - ctrl[2 * iCtrl]) +
+      fabsf(ctrl[2 * iCtrl + 3] - ctrl[2 * iCtrl + 1]);
+
+  }
+
+  int nbSample = (int)ceilf(length * 2.0f);
+  if (nbSample < 1) {
+
+    nbSample = 1;
+
+  }
+
+  return nbSample;
+
+}
+
+// Get in 'from' and 'to' the range of the 'nbSample' + 1 samples of the
+// curve of control points 'ctrl' which may be inside the clipped rows
+// of the Raster 'that'. The range is reduced only for the curves
+// monotonic along y, else it's all the samples
+void RasterGetRangeSampleCurve(
+   const Raster* const that,
+    const float* const ctrl,
+             const int nbSample,
+             int* const from,
+             int* const to) {
+
+  *from = 0;
+  *to = nbSample;
+
+  // The curve is monotonic along y if its control points are, and then
+  // the samples inside the clipped rows, with a margin of one pixel
+  // covering the rounding of the samples, are consecutive
+  float sign = 0.0f;
+  if (
+    ctrl[1] <= ctrl[3] &&
+    ctrl[3] <= ctrl[5] &&
+    ctrl[5] <= ctrl[7]) {
+
+    sign = 1.0f;
+
+  } else if (
+    ctrl[1] >= ctrl[3] &&
+    ctrl[3] >= ctrl[5] &&
+    ctrl[5] >= ctrl[7]) {
+
+    sign = -1.0f;
+
+  }
+
+  if (sign == 0.0f) {
+
+    return;
+
+  }
+
+  float yLow = (float)(that->yMin) - 1.0f;
+  float yHigh = (float)(that->yMax) + 2.0f;
+  float low = (sign > 0.0f ? yLow : -yHigh);
+  float high = (sign > 0.0f ? yHigh : -yLow);
+
+  // Search the first sample above the lower bound
+  int iLow = 0;
+  int iHigh = nbSample + 1;
+  while (iLow < iHigh) {
+
+    int iMid = iLow + (iHigh - iLow) / 2;
+    float y =
+      sign *
+      RasterGetYSampleCurve(
+        ctrl,
+        iMid,
+        nbSample);
+    if (y < low) {
+
+      iLow = iMid + 1;
+
+    } else {
+
+      iHigh = iMid;
+
+    }
+
+  }
+
+  *from = iLow;
+
+  // Search the last sample below the upper bound
+  iHigh = nbSample + 1;
+  while (iLow < iHigh) {
+
+    int iMid = iLow + (iHigh - iLow) / 2;
+    float y =
+      sign *
+      RasterGetYSampleCurve(
+        ctrl,
+        iMid,
+        nbSample);
+    if (y <= high) {
+
+      iLow = iMid + 1;
+
+    } else {
+
+      iHigh = iMid;
+
+    }
+
+  }
+
+  *to = iLow - 1;
+
+}
+
+// Get the y coordinate of the sample 'iSample' of the 'nbSample' + 1
+// samples of the curve of control points 'ctrl', calculated as in the
+// curve kernels
+float RasterGetYSampleCurve(
+  const float* const ctrl,
+           const int iSample,
+           const int nbSample) {
+
+  float t = (float)iSample / (float)nbSample;
+  float u = 1.0f - t;
+  float b0 = u * u * u;
+  float b1 = 3.0f * u * u * t;
+  float b2 = 3.0f * u * t * t;
+  float b3 = t * t * t;
+  return
+    b0 * ctrl[1] + b1 * ctrl[3] + b2 * ctrl[5] + b3 * ctrl[7];
+
+}
+
+// Fill the pixels 'ixMin' to 'ixMax' of the row 'iy' of the Raster
+// 'that' with the color 'color', clipped to its clipped columns and rows
+static inline void RasterFillSpan(
+    Raster* const that,
+             int ixMin,
+             int ixMax,
+       const int iy,
+  const uint32_t color) {
+
+  if (
+    iy < that->yMin ||
+    iy > that->yMax) {
+
+    return;
+
+  }
+
+  ixMin =
+    MAX(
+      ixMin,
+      that->xMin);
+  ixMax =
+    MIN(
+      ixMax,
+      that->xMax);
+  uint32_t* row =
+    that->pixels + (size_t)(iy - that->originY) * (size_t)(that->width);
+  for (
+    int ix = ixMin;
+    ix <= ixMax;
+    ++ix) {
+
+    row[ix - that->originX] = color;
+
+  }
+
+  STATS_ADD(nbPixel, MAX(ixMax - ixMin + 1, 0));
+
+}
+
+// Scalar kernel for RasterDrawDisc
+void RasterDrawDiscScalar(
+    Raster* const that,
+     const float x,
+     const float y,
+     const float radius,
+  const uint32_t color) {
+
+  // The pixel containing the center is always drawn, so that discs
+  // smaller than a pixel remain visible
+  RasterPlot(
+    that,
+    (int)floorf(x),
+    (int)floorf(y),
+    color);
+
+  // Fill the pixels whose center is inside the disc, row by row
+  float sqRadius = radius * radius;
+  int iyMin =
+    MAX(
+      (int)floorf(y - radius),
+      that->yMin);
+  int iyMax =
+    MIN(
+      (int)ceilf(y + radius),
+      that->yMax);
+  for (
+    int iy = iyMin;
+    iy <= iyMax;
+    ++iy) {
+
+    float dy = ((float)iy + 0.5f) - y;
+    float sqHalfWidth = sqRadius - dy * dy;
+    if (sqHalfWidth >= 0.0f) {
+
+      float halfWidth = sqrtf(sqHalfWidth);
+      RasterFillSpan(
+        that,
+        (int)ceilf((x - halfWidth) - 0.5f),
+        (int)floorf((x + halfWidth) - 0.5f),
+        iy,
+        color);
+
+    }
+
+  }
+
+}
+
+// Scalar kernel for RasterDrawCurve
+void RasterDrawCurveScalar(
+     Raster* const that,
+  const float* const ctrl,
+      const uint32_t color) {
+
+  // Plot the nearest pixel of each sample of the curve which may be
+  // inside the clipped rows
+  int nbSample = RasterGetNbSampleCurve(ctrl);
+  int sampleFrom = 0;
+  int sampleTo = 0;
+  RasterGetRangeSampleCurve(
+    that,
+    ctrl,
+    nbSample,
+    &sampleFrom,
+    &sampleTo);
+  for (
+    int iSample = sampleFrom;
+    iSample <= sampleTo;
+    ++iSample) {
+
+    float t = (float)iSample / (float)nbSample;
+    float u = 1.0f - t;
+    float b0 = u * u * u;
+    float b1 = 3.0f * u * u * t;
+    float b2 = 3.0f * u * t * t;
+    float b3 = t * t * t;
+    float x =
+      b0 * ctrl[0] + b1 * ctrl[2] + b2 * ctrl[4] + b3 * ctrl[6];
+    float y =
+      b0 * ctrl[1] + b1 * ctrl[3] + b2 * ctrl[5] + b3 * ctrl[7];
+    RasterPlot(
+      that,
+      (int)floorf(x + 0.5f),
+      (int)floorf(y + 0.5f),
+      color);
+
+  }
+
+}
+
+// Scalar kernel adding the 4 bytes of each of the 'width' pixels of
+// 'row' to the 4 * 'width' sums 'sums', cf RasterDownscale
+void RasterAccumulateRowScalar(
+        uint32_t* const sums,
+  const uint32_t* const row,
+              const int width) {
+
+  for (
+    int x = 0;
+    x < width;
+    ++x) {
+
+    for (
+      int iByte = 0;
+      iByte < 4;
+      ++iByte) {
+
+      sums[4 * x + iByte] += (row[x] >> (8 * iByte)) & 0xFF;
+
+    }
+
+  }
+
+}
+
+#if RASTER_SIMD_X86
+
+// The vectorized kernels below do the same float operations in the
+// same order as the scalar kernels, without fused multiply-add, so
+// they give the same pixels
+
+// Round down the 4 floats of 'v' to integers (SSE2 has no floor)
+static inline __m128i RasterFloorSSE2(const __m128 v) {
+
+  __m128i trunc = _mm_cvttps_epi32(v);
+  __m128 isAbove =
+    _mm_cmpgt_ps(
+      _mm_cvtepi32_ps(trunc),
+      v);
+  return
+    _mm_add_epi32(
+      trunc,
+      _mm_castps_si128(isAbove));
+
+}
+
+// Round up the 4 floats of 'v' to integers (SSE2 has no ceil)
+static inline __m128i RasterCeilSSE2(const __m128 v) {
+
+  __m128i trunc = _mm_cvttps_epi32(v);
+  __m128 isBelow =
+    _mm_cmplt_ps(
+      _mm_cvtepi32_ps(trunc),
+      v);
+  return
+    _mm_sub_epi32(
+      trunc,
+      _mm_castps_si128(isBelow));
+
+}
+
+// SSE2 kernel for RasterDrawDisc
+void RasterDrawDiscSSE2(
+    Raster* const that,
+     const float x,
+     const float y,
+     const float radius,
+  const uint32_t color) {
+
+  RasterPlot(
+    that,
+    (int)floorf(x),
+    (int)floorf(y),
+    color);
+
+  // Calculate the spans of 4 rows at once
+  float sqRadius = radius * radius;
+  int iyMin =
+    MAX(
+      (int)floorf(y - radius),
+      that->yMin);
+  int iyMax =
+    MIN(
+      (int)ceilf(y + radius),
+      that->yMax);
+  __m128 vX = _mm_set1_ps(x);
+  __m128 vY = _mm_set1_ps(y);
+  __m128 vHalf = _mm_set1_ps(0.5f);
+  __m128 vSqRadius = _mm_set1_ps(sqRadius);
+  __m128i vColor = _mm_set1_epi32((int)color);
+  int ixMin[4];
+  int ixMax[4];
+  float sqHalfWidth[4];
+  for (
+    int iy = iyMin;
+    iy <= iyMax;
+    iy += 4) {
+
+    __m128 vDy =
+      _mm_sub_ps(
+        _mm_add_ps(
+          _mm_cvtepi32_ps(
+            _mm_setr_epi32(
+              iy,
+              iy + 1,
+              iy + 2,
+              iy + 3)),
+          vHalf),
+        vY);
+    __m128 vSq =
+      _mm_sub_ps(
+        vSqRadius,
+        _mm_mul_ps(
+          vDy,
+          vDy));
+    __m128 vHalfWidth =
+      _mm_sqrt_ps(
+        _mm_max_ps(
+          vSq,
+          _mm_setzero_ps()));
+    _mm_storeu_ps(
+      sqHalfWidth,
+      vSq);
+    _mm_storeu_si128(
+      (__m128i*)ixMin,
+      RasterCeilSSE2(
+        _mm_sub_ps(
+          _mm_sub_ps(
+            vX,
+            vHalfWidth),
+          vHalf)));
+    _mm_storeu_si128(
+      (__m128i*)ixMax,
+      RasterFloorSSE2(
+        _mm_sub_ps(
+          _mm_add_ps(
+            vX,
+            vHalfWidth),
+          vHalf)));
+
+    // Fill the spans 4 pixels at once
+    for (
+      int iRow = 0;
+      iRow < 4 && iy + iRow <= iyMax;
+      ++iRow) {
+
+      if (sqHalfWidth[iRow] < 0.0f) {
+
+        continue;
+
+      }
+
+      int ixFrom =
+        MAX(
+          ixMin[iRow],
+          that->xMin);
+      int ixTo =
+        MIN(
+          ixMax[iRow],
+          that->xMax);
+      STATS_ADD(nbPixel, MAX(ixTo - ixFrom + 1, 0));
+      uint32_t* row =
+        that->pixels +
+        (size_t)(iy + iRow - that->originY) * (size_t)(that->width);
+      int ix = ixFrom;
+      for (
+        ;
+        ix + 3 <= ixTo;
+        ix += 4) {
+
+        _mm_storeu_si128(
+          (__m128i*)(row + ix - that->originX),
+          vColor);
+
+      }
+
+      for (
+        ;
+        ix <= ixTo;
+        ++ix) {
+
+        row[ix - that->originX] = color;
+
+      }
+
+    }
+
+  }
+
+}
+
+// SSE2 kernel for RasterDrawCurve
+void RasterDrawCurveSSE2(
+     Raster* const that,
+  const float* const ctrl,
+      const uint32_t color) {
+
+  // Evaluate the samples of the curve which may be inside the clipped
+  // rows 4 at once
+  int nbSample = RasterGetNbSampleCurve(ctrl);
+  int sampleFrom = 0;
+  int sampleTo = 0;
+  RasterGetRangeSampleCurve(
+    that,
+    ctrl,
+    nbSample,
+    &sampleFrom,
+    &sampleTo);
+  __m128 vNbSample = _mm_set1_ps((float)nbSample);
+  __m128 vOne = _mm_set1_ps(1.0f);
+  __m128 vThree = _mm_set1_ps(3.0f);
+  __m128 vHalf = _mm_set1_ps(0.5f);
+  int ix[4];
+  int iy[4];
+  for (
+    int iSample = sampleFrom;
+    iSample <= sampleTo;
+    iSample += 4) {
+
+    __m128 t =
+      _mm_div_ps(
+        _mm_cvtepi32_ps(
+          _mm_setr_epi32(
+            iSample,
+            iSample + 1,
+            iSample + 2,
+            iSample + 3)),
+        vNbSample);
+    __m128 u =
+      _mm_sub_ps(
+        vOne,
+        t);
+    __m128 uu =
+      _mm_mul_ps(
+        u,
+        u);
+    __m128 b0 =
+      _mm_mul_ps(
+        uu,
+        u);
+    __m128 b1 =
+      _mm_mul_ps(
+        _mm_mul_ps(
+          _mm_mul_ps(
+            vThree,
+            u),
+          u),
+        t);
+    __m128 b2 =
+      _mm_mul_ps(
+        _mm_mul_ps(
+          _mm_mul_ps(
+            vThree,
+            u),
+          t),
+        t);
+    __m128 b3 =
+      _mm_mul_ps(
+        _mm_mul_ps(
+          t,
+          t),
+        t);
+    for (
+      int iAxis = 0;
+      iAxis < 2;
+      ++iAxis) {
+
+      __m128 p =
+        _mm_add_ps(
+          _mm_add_ps(
+            _mm_add_ps(
+              _mm_mul_ps(
+                b0,
+                _mm_set1_ps(ctrl[iAxis])),
+              _mm_mul_ps(
+                b1,
+                _mm_set1_ps(ctrl[2 + iAxis]))),
+            _mm_mul_ps(
+              b2,
+              _mm_set1_ps(ctrl[4 + iAxis]))),
+          _mm_mul_ps(
+            b3,
+            _mm_set1_ps(ctrl[6 + iAxis])));
+      _mm_storeu_si128(
+        (__m128i*)(iAxis == 0 ? ix : iy),
+        RasterFloorSSE2(
+          _mm_add_ps(
+            p,
+            vHalf)));
+
+    }
+
+    // Plot the samples
+    for (
+      int iLane = 0;
+      iLane < 4 && iSample + iLane <= sampleTo;
+      ++iLane) {
+
+      RasterPlot(
+        that,
+        ix[iLane],
+        iy[iLane],
+        color);
+
+    }
+
+  }
+
+}
+
+// AVX2 kernel for RasterDrawDisc
+__attribute__((target("avx2")))
+void RasterDrawDiscAVX2(
+    Raster* const that,
+     const float x,
+     const float y,
+     const float radius,
+  const uint32_t color) {
+
+  RasterPlot(
+    that,
+    (int)floorf(x),
+    (int)floorf(y),
+    color);
+
+  // Calculate the spans of 8 rows at once
+  float sqRadius = radius * radius;
+  int iyMin =
+    MAX(
+      (int)floorf(y - radius),
+      that->yMin);
+  int iyMax =
+    MIN(
+      (int)ceilf(y + radius),
+      that->yMax);
+  __m256 vX = _mm256_set1_ps(x);
+  __m256 vY = _mm256_set1_ps(y);
+  __m256 vHalf = _mm256_set1_ps(0.5f);
+  __m256 vSqRadius = _mm256_set1_ps(sqRadius);
+  __m256i vColor = _mm256_set1_epi32((int)color);
+  __m256i vStep =
+    _mm256_setr_epi32(
+      0,
+      1,
+      2,
+      3,
+      4,
+      5,
+      6,
+      7);
+  int ixMin[8];
+  int ixMax[8];
+  float sqHalfWidth[8];
+  for (
+    int iy = iyMin;
+    iy <= iyMax;
+    iy += 8) {
+
+    __m256 vDy =
+      _mm256_sub_ps(
+        _mm256_add_ps(
+          _mm256_cvtepi32_ps(
+            _mm256_add_epi32(
+              _mm256_set1_epi32(iy),
+              vStep)),
+          vHalf),
+        vY);
+    __m256 vSq =
+      _mm256_sub_ps(
+        vSqRadius,
+        _mm256_mul_ps(
+          vDy,
+          vDy));
+    __m256 vHalfWidth =
+      _mm256_sqrt_ps(
+        _mm256_max_ps(
+          vSq,
+          _mm256_setzero_ps()));
+    _mm256_storeu_ps(
+      sqHalfWidth,
+      vSq);
+    _mm256_storeu_si256(
+      (__m256i*)ixMin,
+      _mm256_cvttps_epi32(
+        _mm256_ceil_ps(
+          _mm256_sub_ps(
+            _mm256_sub_ps(
+              vX,
+              vHalfWidth),
+            vHalf))));
+    _mm256_storeu_si256(
+      (__m256i*)ixMax,
+      _mm256_cvttps_epi32(
+        _mm256_floor_ps(
+          _mm256_sub_ps(
+            _mm256_add_ps(
+              vX,
+              vHalfWidth),
+            vHalf))));
+
+    // Fill the spans 8 pixels at once
+    for (
+      int iRow = 0;
+      iRow < 8 && iy + iRow <= iyMax;
+      ++iRow) {
+
+      if (sqHalfWidth[iRow] < 0.0f) {
+
+        continue;
+
+      }
+
+      int ixFrom =
+        MAX(
+          ixMin[iRow],
+          that->xMin);
+      int ixTo =
+        MIN(
+          ixMax[iRow],
+          that->xMax);
+      STATS_ADD(nbPixel, MAX(ixTo - ixFrom + 1, 0));
+      uint32_t* row =
+        that->pixels +
+        (size_t)(iy + iRow - that->originY) * (size_t)(that->width);
+      int ix = ixFrom;
+      for (
+        ;
+        ix + 7 <= ixTo;
+        ix += 8) {
+
+        _mm256_storeu_si256(
+          (__m256i*)(row + ix - that->originX),
+          vColor);
+
+      }
+
+      for (
+        ;
+        ix <= ixTo;
+        ++ix) {
+
+        row[ix - that->originX] = color;
+
+      }
+
+    }
+
+  }
+
+}
+
+// AVX2 kernel for RasterDrawCurve
+__attribute__((target("avx2")))
+void RasterDrawCurveAVX2(
+     Raster* const that,
+  const float* const ctrl,
+      const uint32_t color) {
+
+  // Evaluate the samples of the curve which may be inside the clipped
+  // rows 8 at once
+  int nbSample = RasterGetNbSampleCurve(ctrl);
+  int sampleFrom = 0;
+  int sampleTo = 0;
+  RasterGetRangeSampleCurve(
+    that,
+    ctrl,
+    nbSample,
+    &sampleFrom,
+    &sampleTo);
+  __m256 vNbSample = _mm256_set1_ps((float)nbSample);
+  __m256 vOne = _mm256_set1_ps(1.0f);
+  __m256 vThree = _mm256_set1_ps(3.0f);
+  __m256 vHalf = _mm256_set1_ps(0.5f);
+  __m256i vStep =
+    _mm256_setr_epi32(
+      0,
+      1,
+      2,
+      3,
+      4,
+      5,
+      6,
+      7);
+  int ix[8];
+  int iy[8];
+  for (
+    int iSample = sampleFrom;
+    iSample <= sampleTo;
+    iSample += 8) {
+
+    __m256 t =
+      _mm256_div_ps(
+        _mm256_cvtepi32_ps(
+          _mm256_add_epi32(
+            _mm256_set1_epi32(iSample),
+            vStep)),
+        vNbSample);
+    __m256 u =
+      _mm256_sub_ps(
+        vOne,
+        t);
+    __m256 uu =
+      _mm256_mul_ps(
+        u,
+        u);
+    __m256 b0 =
+      _mm256_mul_ps(
+        uu,
+        u);
+    __m256 b1 =
+      _mm256_mul_ps(
+        _mm256_mul_ps(
+          _mm256_mul_ps(
+            vThree,
+            u),
+          u),
+        t);
+    __m256 b2 =
+      _mm256_mul_ps(
+        _mm256_mul_ps(
+          _mm256_mul_ps(
+            vThree,
+            u),
+          t),
+        t);
+    __m256 b3 =
+      _mm256_mul_ps(
+        _mm256_mul_ps(
+          t,
+          t),
+        t);
+    for (
+      int iAxis = 0;
+      iAxis < 2;
+      ++iAxis) {
+
+      __m256 p =
+        _mm256_add_ps(
+          _mm256_add_ps(
+            _mm256_add_ps(
+              _mm256_mul_ps(
+                b0,
+                _mm256_set1_ps(ctrl[iAxis])),
+              _mm256_mul_ps(
+                b1,
+                _mm256_set1_ps(ctrl[2 + iAxis]))),
+            _mm256_mul_ps(
+              b2,
+              _mm256_set1_ps(ctrl[4 + iAxis]))),
+          _mm256_mul_ps(
+            b3,
+            _mm256_set1_ps(ctrl[6 + iAxis])));
+      _mm256_storeu_si256(
+        (__m256i*)(iAxis == 0 ? ix : iy),
+        _mm256_cvttps_epi32(
+          _mm256_floor_ps(
+            _mm256_add_ps(
+              p,
+              vHalf))));
+
+    }
+
+    // Plot the samples
+    for (
+      int iLane = 0;
+      iLane < 8 && iSample + iLane <= sampleTo;
+      ++iLane) {
+
+      RasterPlot(
+        that,
+        ix[iLane],
+        iy[iLane],
+        color);
+
+    }
+
+  }
+
+}
+
+// SSE2 kernel for RasterAccumulateRowScalar
+void RasterAccumulateRowSSE2(
+        uint32_t* const sums,
+  const uint32_t* const row,
+              const int width) {
+
+  // Widen the bytes of 4 pixels at once to 32 bits and add them to
+  // the sums, the bytes being in the same order in memory
+  __m128i zero = _mm_setzero_si128();
+  int x = 0;
+  for (
+    ;
+    x + 4 <= width;
+    x += 4) {
+
+    __m128i pixels = _mm_loadu_si128((const __m128i*)(row + x));
+    __m128i words[2] = {
+      _mm_unpacklo_epi8(
+        pixels,
+        zero),
+      _mm_unpackhi_epi8(
+        pixels,
+        zero)
+    };
+    __m128i* dst = (__m128i*)(sums + 4 * x);
+    for (
+      int iWord = 0;
+      iWord < 2;
+      ++iWord) {
+
+      _mm_storeu_si128(
+        dst + 2 * iWord,
+        _mm_add_epi32(
+          _mm_loadu_si128(dst + 2 * iWord),
+          _mm_unpacklo_epi16(
+            words[iWord],
+            zero)));
+      _mm_storeu_si128(
+        dst + 2 * iWord + 1,
+        _mm_add_epi32(
+          _mm_loadu_si128(dst + 2 * iWord + 1),
+          _mm_unpackhi_epi16(
+            words[iWord],
+            zero)));
+
+    }
+
+  }
+
+  // Add the remaining pixels
+  RasterAccumulateRowScalar(
+    sums + 4 * x,
+    row + x,
+    width - x);
+
+}
+
+// AVX2 kernel for RasterAccumulateRowScalar
+__attribute__((target("avx2")))
+void RasterAccumulateRowAVX2(
+        uint32_t* const sums,
+  const uint32_t* const row,
+              const int width) {
+
+  // Widen the bytes of 2 pixels at once to 32 bits, 8 pixels per
+  // iteration, and add them to the sums
+  int x = 0;
+  for (
+    ;
+    x + 8 <= width;
+    x += 8) {
+
+    for (
+      int iPair = 0;
+      iPair < 4;
+      ++iPair) {
+
+      __m128i pair =
+        _mm_loadl_epi64((const __m128i*)(row + x + 2 * iPair));
+      __m256i* dst = (__m256i*)(sums + 4 * (x + 2 * iPair));
+      _mm256_storeu_si256(
+        dst,
+        _mm256_add_epi32(
+          _mm256_loadu_si256(dst),
+          _mm256_cvtepu8_epi32(pair)));
+
+    }
+
+  }
+
+  // Add the remaining pixels
+  RasterAccumulateRowScalar(
+    sums + 4 * x,
+    row + x,
+    width - x);
+
+}
+
+#endif
+
+// Draw the same random discs and curves with each kernel supported by
+// the CPU and compare the result with the scalar kernel, then
+// accumulate the rows of the result with each kernel and compare the
+// sums with the scalar kernel
+// Return true if all the kernels are within tolerance, else false
+bool RasterCheckKernels(void) {
+
+  // Names of the kernels to check
+  const char* names[] = {"sse2", "avx2"};
+  int nbName = sizeof(names) / sizeof(names[0]);
+
+  // Draw the primitives with the scalar kernels in the reference
+  // raster and with the checked kernels in the other one, the
+  // primitives overlap the borders of the raster to check the clipping
+  int width = 509;
+  int height = 307;
+  Raster rasters[2];
+  for (
+    int iRaster = 0;
+    iRaster < 2;
+    ++iRaster) {
+
+    rasters[iRaster] =
+      RasterCreateStatic(
+        width,
+        height);
+
+  }
+
+  bool ret = true;
+  for (
+    int iName = 0;
+    iName < nbName;
+    ++iName) {
+
+    const RasterKernels* kernels = RasterGetKernels(names[iName]);
+    if (kernels == NULL) {
+
+      printf(
+        "Kernels %s: not supported, skipped\n",
+        names[iName]);
+      continue;
+
+    }
+
+    const RasterKernels* kernelsRaster[2] = {
+      &rasterKernelsScalar,
+      kernels
+    };
+    for (
+      int iRaster = 0;
+      iRaster < 2;
+      ++iRaster) {
+
+      RasterFill(
+        &(rasters[iRaster]),
+        RASTER_RGBA(255, 255, 255, 255));
+      srand(1);
+      for (
+        int iPrim = 0;
+        iPrim < 200;
+        ++iPrim) {
+
+        float ctrl[8];
+        for (
+          int iCtrl = 0;
+          iCtrl < 8;
+          ++iCtrl) {
+
+          float size = (iCtrl % 2 == 0 ? width : height);
+          ctrl[iCtrl] =
+            ((float)rand() / (float)RAND_MAX * 1.2f - 0.1f) * size;
+
+        }
+
+        float radius =
+          powf(
+            (float)rand() / (float)RAND_MAX,
+            3.0f) * 30.0f;
+        uint32_t color = (uint32_t)rand() | 0xFF000000;
+        kernelsRaster[iRaster]->drawDisc(
+          &(rasters[iRaster]),
+          ctrl[0],
+          ctrl[1],
+          radius,
+          color);
+        kernelsRaster[iRaster]->drawCurve(
+          &(rasters[iRaster]),
+          ctrl,
+          color);
+
+      }
+
+    }
+
+    // Count the pixels which differ, and the drawn ones
+    unsigned long nbDiff = 0;
+    unsigned long nbDrawn = 0;
+    size_t nbPixel = (size_t)width * (size_t)height;
+    for (
+      size_t iPixel = 0;
+      iPixel < nbPixel;
+      ++iPixel) {
+
+      if (rasters[0].pixels[iPixel] != rasters[1].pixels[iPixel]) {
+
+        ++nbDiff;
+
+      }
+
+      if (rasters[0].pixels[iPixel] != RASTER_RGBA(255, 255, 255, 255)) {
+
+        ++nbDrawn;
+
+      }
+
+    }
+
+    bool isOk =
+      ((double)nbDiff <= RASTER_KERNEL_TOLERANCE * (double)nbDrawn);
+    printf(
+      "Kernels %s: %lu pixels differ from scalar out of %lu drawn, %s\n",
+      kernels->name,
+      nbDiff,
+      nbDrawn,
+      (isOk == true ? "OK" : "FAILED"));
+    if (isOk == false) {
+
+      ret = false;
+
+    }
+
+    // Accumulate the rows of the reference raster with the scalar
+    // kernel and the checked one, the odd width checking the remaining
+    // pixels of the vectorized kernels, and count the sums which differ
+    uint32_t* sums[2];
+    for (
+      int iRaster = 0;
+      iRaster < 2;
+      ++iRaster) {
+
+      sums[iRaster] =
+        PBErrMalloc(
+          GAViewerErr,
+          sizeof(uint32_t) * 4 * (size_t)width);
+      memset(
+        sums[iRaster],
+        0,
+        sizeof(uint32_t) * 4 * (size_t)width);
+      for (
+        int y = 0;
+        y < height;
+        ++y) {
+
+        kernelsRaster[iRaster]->accumulateRow(
+          sums[iRaster],
+          rasters[0].pixels + (size_t)y * (size_t)width,
+          width);
+
+      }
+
+    }
+
+    unsigned long nbDiffSum = 0;
+    for (
+      int iSum = 0;
+      iSum < 4 * width;
+      ++iSum) {
+
+      if (sums[0][iSum] != sums[1][iSum]) {
+
+        ++nbDiffSum;
+
+      }
+
+    }
+
+    printf(
+      "Kernels %s: %lu sums of rows differ from scalar, %s\n",
+      kernels->name,
+      nbDiffSum,
+      (nbDiffSum == 0 ? "OK" : "FAILED"));
+    if (nbDiffSum > 0) {
+
+      ret = false;
+
+    }
+
+    free(sums[0]);
+    free(sums[1]);
+
+  }
+
+  // Free memory
+  for (
+    int iRaster = 0;
+    iRaster < 2;
+    ++iRaster) {
+
+    RasterFree(&(rasters[iRaster]));
+
+  }
+
+  // Return the success code
+  return ret;
+
+}
+
+// Downscale the Raster 'that' into the Raster 'raster' with a box
+// filter, each pixel of 'raster' being the rounded average of the
+// block of pixels of 'that' it covers. The dimensions of 'that' must be
+// multiples of the ones of 'raster'
+void RasterDownscale(
+  const Raster* const that,
+        Raster* const raster) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (raster == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'raster' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (
+    that->width % raster->width != 0 ||
+    that->height % raster->height != 0) {
+
+    GAViewerErr->_type = PBErrTypeInvalidArg;
+    sprintf(
+      GAViewerErr->_msg,
+      "the dimensions of 'that' (%dx%d) are not multiples of the ones " \
+      "of 'raster' (%dx%d)",
+      that->width,
+      that->height,
+      raster->width,
+      raster->height);
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Loop on the rows of the downscaled raster
+  int factorX = that->width / raster->width;
+  int factorY = that->height / raster->height;
+  uint32_t nbPixelBlock = (uint32_t)factorX * (uint32_t)factorY;
+  uint32_t* sums =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(uint32_t) * 4 * (size_t)(that->width));
+  for (
+    int y = 0;
+    y < raster->height;
+    ++y) {
+
+    // Sum the bytes of the pixels of each column over the rows of the
+    // blocks with the vectorized kernel
+    memset(
+      sums,
+      0,
+      sizeof(uint32_t) * 4 * (size_t)(that->width));
+    for (
+      int iRow = 0;
+      iRow < factorY;
+      ++iRow) {
+
+      rasterKernels->accumulateRow(
+        sums,
+        that->pixels +
+          (size_t)(y * factorY + iRow) * (size_t)(that->width),
+        that->width);
+
+    }
+
+    // Sum the columns of each block and pack their rounded averages
+    uint32_t* pixels = raster->pixels + (size_t)y * (size_t)(raster->width);
+    for (
+      int x = 0;
+      x < raster->width;
+      ++x) {
+
+      uint32_t pixel = 0;
+      for (
+        int iByte = 0;
+        iByte < 4;
+        ++iByte) {
+
+        uint32_t sum = 0;
+        for (
+          int iCol = 0;
+          iCol < factorX;
+          ++iCol) {
+
+          sum += sums[4 * (x * factorX + iCol) + iByte];
+
+        }
+
+        pixel |=
+          ((sum + nbPixelBlock / 2) / nbPixelBlock) << (8 * iByte);
+
+      }
+
+      pixels[x] = pixel;
+
+    }
+
+  }
+
+  // Free memory
+  free(sums);
+
+}
+
+
+// Save the Raster 'that' at 'path' in the format 'format', the rows
+// being encoded by 'nbThread' threads
+// Return true if successfull, else false
+bool RasterSave(
+  const Raster* const that,
+    const char* const path,
+    const ImgFormat format,
+          const int nbThread) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  ImgWriter* writer =
+    ImgWriterCreate(
+      path,
+      that->width,
+      that->height,
+      format,
+      nbThread);
+  if (writer == NULL) {
+
+    return false;
+
+  }
+
+  // Add the rows from the top of the image
+  bool ret = true;
+  for (
+    int iRow = that->height - 1;
+    iRow >= 0 && ret == true;
+    --iRow) {
+
+    ret =
+      ImgWriterAddRow(
+        writer,
+        that->pixels + (size_t)iRow * (size_t)(that->width));
+
+  }
+
+  ret = ImgWriterClose(writer) && ret;
+  ImgWriterFree(&writer);
+
+  // Return the success code
+  return ret;
+
+}
+
+// Get the format of the image file at 'path' from its extension: PNG
+// for .png, else TGA
+ImgFormat ImgFormatFromPath(const char* const path) {
+
+#if BUILDMODE == 0
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  const char* ext = strrchr(path, '.');
+  if (
+    ext != NULL &&
+    strcasecmp(
+      ext,
+      ".png") == 0) {
+
+    return ImgFormatPng;
+
+  }
+
+  return ImgFormatTga;
+
+}
+
+// Create a new ImgWriter writing the image of 'width' x 'height'
+// pixels in the format 'format' at 'path', encoding its rows with
+// 'nbThread' threads
+// Return NULL if the file couldn't be opened
+ImgWriter* ImgWriterCreate(
+  const char* const path,
+          const int width,
+          const int height,
+    const ImgFormat format,
+          const int nbThread) {
+
+#if BUILDMODE == 0
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (
+    width <= 0 ||
+    height <= 0) {
+
+    GAViewerErr->_type = PBErrTypeInvalidArg;
+    sprintf(
+      GAViewerErr->_msg,
+      "Invalid dimensions (%dx%d)",
+      width,
+      height);
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // The dimensions of TGA images are stored on 16 bits
+  if (
+    format == ImgFormatTga &&
+    (width > IMGWRITER_SIZETGAMAX ||
+    height > IMGWRITER_SIZETGAMAX)) {
+
+    fprintf(
+      stderr,
+      "The TGA format is limited to %dpx per side, save the image " \
+      "as PNG\n",
+      IMGWRITER_SIZETGAMAX);
+    return NULL;
+
+  }
+
+  // Open the file
+  FILE* stream =
+    fopen(
+      path,
+      "wb");
+  if (stream == NULL) {
+
+    return NULL;
+
+  }
+
+  // Allocate memory for the ImgWriter
+  ImgWriter* that =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(ImgWriter));
+
+  // Init the properties
+  that->stream = stream;
+  that->format = format;
+  that->width = width;
+  that->height = height;
+  that->nbThread =
+    MAX(
+      nbThread,
+      1);
+  that->nbRow = 0;
+  that->sizeRow =
+    (format == ImgFormatPng ?
+      1 + 3 * (size_t)width : 4 * (size_t)width);
+  that->nbRowStrip =
+    (int)MAX(
+      IMGWRITER_SIZESTRIP / that->sizeRow,
+      (size_t)1);
+  that->nbStripBatch = that->nbThread;
+  that->raw =
+    PBErrMalloc(
+      GAViewerErr,
+      IMGWRITER_SIZEDICT +
+      that->sizeRow * (size_t)(that->nbRowStrip) *
+      (size_t)(that->nbStripBatch));
+  that->sizeHistory = 0;
+  that->nbRowPending = 0;
+  that->strips =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(ImgStrip) * (size_t)(that->nbStripBatch));
+  for (
+    int iStrip = 0;
+    iStrip < that->nbStripBatch;
+    ++iStrip) {
+
+    that->strips[iStrip].data = NULL;
+    that->strips[iStrip].sizeAlloc = 0;
+
+  }
+
+  that->adler =
+    adler32(
+      0L,
+      Z_NULL,
+      0);
+  that->isFailed = false;
+
+  // Write the header
+  if (format == ImgFormatPng) {
+
+    // Signature, then header: 8 bits RGB, no interlace, then the
+    // header of the zlib stream of the pixels, in its own chunk as the
+    // strips are written in their own chunks
+    static const unsigned char signature[8] = {
+      0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'
+    };
+    unsigned char header[13] = {0};
+    for (
+      int iByte = 0;
+      iByte < 4;
+      ++iByte) {
+
+      header[iByte] = ((uint32_t)width >> (24 - 8 * iByte)) & 0xFF;
+      header[4 + iByte] = ((uint32_t)height >> (24 - 8 * iByte)) & 0xFF;
+
+    }
+
+    header[8] = 8;
+    header[9] = 2;
+    static const unsigned char headerZlib[2] = {0x78, 0x9C};
+    that->isFailed =
+      !(fwrite(
+        signature,
+        1,
+        sizeof(signature),
+        stream) == sizeof(signature) &&
+      ImgWriterWritePngChunk(
+        stream,
+        "IHDR",
+        header,
+        sizeof(header)) &&
+      ImgWriterWritePngChunk(
+        stream,
+        "IDAT",
+        headerZlib,
+        sizeof(headerZlib)));
+
+  } else {
+
+    // True color run length encoded image, origin at the top left
+    // corner as the rows are received from the top, 32 bits per pixel
+    // with 8 bits of alpha
+    unsigned char header[18] = {0};
+    header[2] = 10;
+    header[12] = width & 0xFF;
+    header[13] = (width >> 8) & 0xFF;
+    header[14] = height & 0xFF;
+    header[15] = (height >> 8) & 0xFF;
+    header[16] = 32;
+    header[17] = 0x28;
+    that->isFailed =
+      (fwrite(
+        header,
+        1,
+        sizeof(header),
+        stream) != sizeof(header));
+
+  }
+
+  // Return the new ImgWriter
+  return that;
+
+}
+
+// Free the memory used by the ImgWriter 'that', closing its file if
+// it's still open
+void ImgWriterFree(ImgWriter** const that) {
+
+  if (that == NULL || *that == NULL) return;
+
+  // Free memory
+  if ((*that)->stream != NULL) {
+
+    fclose((*that)->stream);
+
+  }
+
+  for (
+    int iStrip = 0;
+    iStrip < (*that)->nbStripBatch;
+    ++iStrip) {
+
+    free((*that)->strips[iStrip].data);
+
+  }
+
+  free((*that)->strips);
+  free((*that)->raw);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Add the next row 'row', of packed 0xAARRGGBB pixels, to the image of
+// the ImgWriter 'that', the rows being added from the top of the image
+// Return false if an error occured, else true
+bool ImgWriterAddRow(
+       ImgWriter* const that,
+  const uint32_t* const row) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (row == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'row' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  if (
+    that->isFailed == true ||
+    that->nbRow >= that->height) {
+
+    that->isFailed = true;
+    return false;
+
+  }
+
+  // Copy the row in the raw buffer, in the format of the file: packed
+  // pixels are the byte order of TGA on little endian hosts, PNG rows
+  // are preceded by their filter type (none)
+  unsigned char* raw =
+    that->raw + IMGWRITER_SIZEDICT +
+    that->sizeRow * (size_t)(that->nbRowPending);
+  if (that->format == ImgFormatPng) {
+
+    raw[0] = 0;
+    for (
+      int iCol = 0;
+      iCol < that->width;
+      ++iCol) {
+
+      raw[1 + 3 * iCol] = (row[iCol] >> 16) & 0xFF;
+      raw[2 + 3 * iCol] = (row[iCol] >> 8) & 0xFF;
+      raw[3 + 3 * iCol] = row[iCol] & 0xFF;
+
+    }
+
+  } else {
+
+    memcpy(
+      raw,
+      row,
+      that->sizeRow);
+
+  }
+
+  ++(that->nbRow);
+  ++(that->nbRowPending);
+
+  // Encode and write the batch when it's complete or when it's the
+  // last row
+  if (
+    that->nbRowPending == that->nbRowStrip * that->nbStripBatch ||
+    that->nbRow == that->height) {
+
+    ImgWriterFlush(that);
+
+  }
+
+  return (that->isFailed == false);
+
+}
+
+// Write the end of the image of the ImgWriter 'that' and close its
+// file
+// Return true if the whole image was written successfully, else false
+bool ImgWriterClose(ImgWriter* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  if (that->stream == NULL) {
+
+    return false;
+
+  }
+
+  // The image must be complete
+  bool ret =
+    (that->isFailed == false &&
+    that->nbRow == that->height);
+
+  // Write the checksum of the zlib stream and the end of the PNG
+  if (
+    ret == true &&
+    that->format == ImgFormatPng) {
+
+    unsigned char adler[4] = {
+      (that->adler >> 24) & 0xFF,
+      (that->adler >> 16) & 0xFF,
+      (that->adler >> 8) & 0xFF,
+      that->adler & 0xFF
+    };
+    ret =
+      ImgWriterWritePngChunk(
+        that->stream,
+        "IDAT",
+        adler,
+        sizeof(adler)) &&
+      ImgWriterWritePngChunk(
+        that->stream,
+        "IEND",
+        NULL,
+        0);
+
+  }
+
+  // Close the file
+  if (fclose(that->stream) != 0) {
+
+    ret = false;
+
+  }
+
+  that->stream = NULL;
+
+  // Return the success code
+  return ret;
+
+}
+
+// Encode in parallel and write the strips of rows waiting in the
+// ImgWriter 'that'
+void ImgWriterFlush(ImgWriter* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  if (that->nbRowPending == 0) {
+
+    return;
+
+  }
+
+  // Split the waiting rows into strips
+  int nbStrip = (that->nbRowPending - 1) / that->nbRowStrip + 1;
+  size_t sizeStrip = that->sizeRow * (size_t)(that->nbRowStrip);
+  size_t sizeRaw = that->sizeRow * (size_t)(that->nbRowPending);
+  for (
+    int iStrip = 0;
+    iStrip < nbStrip;
+    ++iStrip) {
+
+    ImgStrip* strip = that->strips + iStrip;
+    strip->offsetRaw = IMGWRITER_SIZEDICT + sizeStrip * (size_t)iStrip;
+    strip->sizeRaw =
+      MIN(
+        sizeStrip,
+        sizeRaw - sizeStrip * (size_t)iStrip);
+    strip->isLast =
+      (that->nbRow == that->height &&
+      iStrip == nbStrip - 1);
+    strip->isFailed = false;
+
+  }
+
+  // Encode the strips
+  ParallelFor(
+    that->nbThread,
+    nbStrip,
+    nbStrip,
+    ImgWriterTaskEncode,
+    that);
+
+  // Write the strips in their order
+  for (
+    int iStrip = 0;
+    iStrip < nbStrip && that->isFailed == false;
+    ++iStrip) {
+
+    ImgStrip* strip = that->strips + iStrip;
+    if (strip->isFailed == true) {
+
+      that->isFailed = true;
+
+    } else if (that->format == ImgFormatPng) {
+
+      that->isFailed =
+        !ImgWriterWritePngChunk(
+          that->stream,
+          "IDAT",
+          strip->data,
+          (uint32_t)(strip->size));
+      that->adler =
+        adler32_combine(
+          that->adler,
+          strip->adler,
+          (z_off_t)(strip->sizeRaw));
+
+    } else {
+
+      that->isFailed =
+        (fwrite(
+          strip->data,
+          1,
+          strip->size,
+          that->stream) != strip->size);
+
+    }
+
+  }
+
+  // Keep the end of the raw rows as the dictionary of the next batch
+  size_t sizeKeep =
+    MIN(
+      (size_t)IMGWRITER_SIZEDICT,
+      that->sizeHistory + sizeRaw);
+  memmove(
+    that->raw + IMGWRITER_SIZEDICT - sizeKeep,
+    that->raw + IMGWRITER_SIZEDICT + sizeRaw - sizeKeep,
+    sizeKeep);
+  that->sizeHistory = sizeKeep;
+  that->nbRowPending = 0;
+
+}
+
+// Task encoding the strips of an ImgWriter, 'arg' is the ImgWriter
+void ImgWriterTaskEncode(
+      void* const arg,
+   const uint64_t from,
+   const uint64_t to,
+   const uint64_t iChunk) {
+
+  (void)iChunk;
+  ImgWriter* that = arg;
+  for (
+    uint64_t iStrip = from;
+    iStrip < to;
+    ++iStrip) {
+
+    ImgStrip* strip = that->strips + iStrip;
+
+    // Make sure there is enough memory for the encoded strip, the
+    // worst case of the run length encoding being one packet header
+    // per 128 pixels of each row
+    size_t sizeMax =
+      strip->sizeRaw +
+      (strip->sizeRaw / that->sizeRow) * (size_t)(that->width / 128 + 1) +
+      64;
+    if (that->format == ImgFormatPng) {
+
+      sizeMax = compressBound(strip->sizeRaw) + 64;
+
+    }
+
+    if (strip->sizeAlloc < sizeMax) {
+
+      free(strip->data);
+      strip->data =
+        PBErrMalloc(
+          GAViewerErr,
+          sizeMax);
+      strip->sizeAlloc = sizeMax;
+
+    }
+
+    if (that->format == ImgFormatPng) {
+
+      ImgWriterEncodePng(
+        that,
+        strip);
+
+    } else {
+
+      ImgWriterEncodeTga(
+        that,
+        strip);
+
+    }
+
+  }
+
+}
+
+// Encode the strip 'strip' of the ImgWriter 'that' as run length
+// encoded TGA pixels, each row being encoded separately
+void ImgWriterEncodeTga(
+  const ImgWriter* const that,
+       ImgStrip* const strip) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (strip == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'strip' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Loop on the rows of the strip
+  unsigned char* out = strip->data;
+  for (
+    size_t offset = 0;
+    offset < strip->sizeRaw;
+    offset += that->sizeRow) {
+
+    const uint32_t* row =
+      (const uint32_t*)(that->raw + strip->offsetRaw + offset);
+    int iCol = 0;
+    while (iCol < that->width) {
+
+      // Get the length of the run of identical pixels starting here
+      int nbRun = 1;
+      while (
+        iCol + nbRun < that->width &&
+        nbRun < 128 &&
+        row[iCol + nbRun] == row[iCol]) {
+
+        ++nbRun;
+
+      }
+
+      // Runs of 2 pixels or more are written as one packet
+      if (nbRun > 1) {
+
+        *(out++) = 0x80 | (nbRun - 1);
+        memcpy(
+          out,
+          row + iCol,
+          4);
+        out += 4;
+        iCol += nbRun;
+
+      // Else write the pixels up to the next run as a raw packet
+      } else {
+
+        int nbRaw = 1;
+        while (
+          iCol + nbRaw < that->width &&
+          nbRaw < 128 &&
+          (iCol + nbRaw + 1 >= that->width ||
+          row[iCol + nbRaw] != row[iCol + nbRaw + 1])) {
+
+          ++nbRaw;
+
+        }
+
+        *(out++) = nbRaw - 1;
+        memcpy(
+          out,
+          row + iCol,
+          4 * (size_t)nbRaw);
+        out += 4 * nbRaw;
+        iCol += nbRaw;
+
+      }
+
+    }
+
+  }
+
+  strip->size = (size_t)(out - strip->data);
+
+}
+
+// Encode the strip 'strip' of the ImgWriter 'that' as deflate blocks
+// ending on a byte boundary, which can be concatenated with the ones of
+// the other strips, the raw bytes preceding the strip being used as
+// dictionary
+void ImgWriterEncodePng(
+  const ImgWriter* const that,
+       ImgStrip* const strip) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (strip == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'strip' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  unsigned char* raw = that->raw + strip->offsetRaw;
+  strip->adler =
+    adler32(
+      adler32(
+        0L,
+        Z_NULL,
+        0),
+      raw,
+      (uInt)(strip->sizeRaw));
+
+  // Raw deflate stream, the zlib header and checksum being written by
+  // the ImgWriter
+  z_stream zStream;
+  zStream.zalloc = Z_NULL;
+  zStream.zfree = Z_NULL;
+  zStream.opaque = Z_NULL;
+  if (
+    deflateInit2(
+      &zStream,
+      Z_DEFAULT_COMPRESSION,
+      Z_DEFLATED,
+      -15,
+      8,
+      Z_DEFAULT_STRATEGY) != Z_OK) {
+
+    strip->isFailed = true;
+    return;
+
+  }
+
+  // Use the raw bytes preceding the strip as dictionary, so the strips
+  // compress as well as a single stream
+  size_t sizeDict =
+    MIN(
+      (size_t)IMGWRITER_SIZEDICT,
+      strip->offsetRaw - IMGWRITER_SIZEDICT + that->sizeHistory);
+  if (sizeDict > 0) {
+
+    deflateSetDictionary(
+      &zStream,
+      raw - sizeDict,
+      (uInt)sizeDict);
+
+  }
+
+  // Compress the strip, the last one ending the deflate stream, the
+  // other ones being flushed to a byte boundary
+  zStream.next_in = raw;
+  zStream.avail_in = (uInt)(strip->sizeRaw);
+  zStream.next_out = strip->data;
+  zStream.avail_out = (uInt)(strip->sizeAlloc);
+  int ret =
+    deflate(
+      &zStream,
+      (strip->isLast == true ? Z_FINISH : Z_SYNC_FLUSH));
+  strip->isFailed =
+    (strip->isLast == true ?
+      ret != Z_STREAM_END :
+      ret != Z_OK || zStream.avail_in != 0);
+  strip->size = strip->sizeAlloc - zStream.avail_out;
+  deflateEnd(&zStream);
+
+}
+
+// Write the PNG chunk of type 'type' and data 'data' of 'size' bytes
+// in the stream 'stream'
+// Return true if successfull, else false
+bool ImgWriterWritePngChunk(
+           FILE* const stream,
+     const char* const type,
+  const unsigned char* const data,
+         const uint32_t size) {
+
+#if BUILDMODE == 0
+  if (stream == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'stream' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+  if (type == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'type' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Length and CRC of the chunk are big endian, the CRC covering the
+  // type and the data
+  unsigned char length[4] = {
+    (size >> 24) & 0xFF,
+    (size >> 16) & 0xFF,
+    (size >> 8) & 0xFF,
+    size & 0xFF
+  };
+  uLong crc =
+    crc32(
+      0L,
+      (const Bytef*)type,
+      4);
+  if (size > 0) {
+
+    crc =
+      crc32(
+        crc,
+        data,
+        size);
+
+  }
+
+  unsigned char crcBytes[4] = {
+    (crc >> 24) & 0xFF,
+    (crc >> 16) & 0xFF,
+    (crc >> 8) & 0xFF,
+    crc & 0xFF
+  };
+  return
+    fwrite(
+      length,
+      1,
+      4,
+      stream) == 4 &&
+    fwrite(
+      type,
+      1,
+      4,
+      stream) == 4 &&
+    (size == 0 ||
+    fwrite(
+      data,
+      1,
+      size,
+      stream) == size) &&
+    fwrite(
+      crcBytes,
+      1,
+      4,
+      stream) == 4;
+
+}
+
+// Create a new SvgWriter writing at 'path'
+// Return NULL if the file couldn't be opened
+SvgWriter* SvgWriterCreate(const char* const path) {
+
+#if BUILDMODE == 0
+  if (path == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'path' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Open the file
+  FILE* stream =
+    fopen(
+      path,
+      "wb");
+  if (stream == NULL) {
+
+    return NULL;
+
+  }
+
+  // Allocate memory for the SvgWriter
+  SvgWriter* that =
+    PBErrMalloc(
+      GAViewerErr,
+      sizeof(SvgWriter));
+
+  // Init the properties
+  that->stream = stream;
+  that->buffer =
+    PBErrMalloc(
+      GAViewerErr,
+      SVGWRITER_SIZEBUFFER);
+  that->size = 0;
+  that->isFailed = false;
+
+  // Return the new SvgWriter
+  return that;
+
+}
+
+// Free the memory used by the SvgWriter 'that', closing its file if
+// it's still open
+void SvgWriterFree(SvgWriter** const that) {
+
+  if (that == NULL || *that == NULL) return;
+
+  // Free memory
+  if ((*that)->stream != NULL) {
+
+    fclose((*that)->stream);
+
+  }
+
+  free((*that)->buffer);
+  free(*that);
+  *that = NULL;
+
+}
 
-      // Try to open the file to check the path
-      FILE* stream =
-        fopen(
-          argv[iArg + 1],
-          "w");
+// Add the string 'str' to the SvgWriter 'that'
+void SvgWriterAddStr(
+   SvgWriter* const that,
+  const char* const str) {
 
-      // If the path is correct
-      if (stream != NULL) {
+#if BUILDMODE == 0
+  if (that == NULL) {
 
-        // Update the path to history image file
-        that->pathHistoryImg = strdup(argv[iArg + 1]);
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
 
-        // Close the stream
-        fclose(stream);
+  }
 
-        // Create the image from history
-        bool ret = GAViewerHistoryToImg(that);
-        if (ret == false) {
+  if (str == NULL) {
 
-          fprintf(
-            stderr,
-            "Failed to create the history image\n");
-          return false;
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'str' is null");
+    PBErrCatch(GAViewerErr);
 
-        }
+  }
 
-      // Else the path is incorrect
-      } else {
+#endif
 
-        fprintf(
-          stderr,
-          "The path [%s] is incorrect\n",
-          argv[iArg + 1]);
-        return false;
+  // Copy the string in the buffer, writing the buffer each time it's
+  // full
+  const char* ptr = str;
+  while (*ptr != '\0') {
 
-      }
+    if (that->size == SVGWRITER_SIZEBUFFER) {
+
+      SvgWriterFlush(that);
 
     }
 
+    that->buffer[that->size] = *ptr;
+    ++(that->size);
+    ++ptr;
+
   }
 
-  // Return the successfull code
-  return true;
+}
+
+// Add the number 'val' to the SvgWriter 'that', rounded to 2 decimals
+// without the trailing zeros
+void SvgWriterAddNum(
+  SvgWriter* const that,
+       const float val) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'that' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
+#endif
+
+  // Make room for the longest number
+  if (that->size + 32 > SVGWRITER_SIZEBUFFER) {
+
+    SvgWriterFlush(that);
+
+  }
+
+  // Convert the number into hundredths, and write its sign
+  char* ptr = that->buffer + that->size;
+  long long hundredths = llroundf(val * 100.0f);
+  if (hundredths < 0) {
+
+    *(ptr++) = '-';
+    hundredths = -hundredths;
+
+  }
+
+  // Write the digits of the integer part, from the last one, then
+  // reverse them
+  long long integer = hundredths / 100;
+  char* digits = ptr;
+  do {
+
+    *(ptr++) = (char)('0' + integer % 10);
+    integer /= 10;
+
+  } while (integer > 0);
+
+  for (
+    char* left = digits, *right = ptr - 1;
+    left < right;
+    ++left, --right) {
+
+    char c = *left;
+    *left = *right;
+    *right = c;
+
+  }
+
+  // Write the decimals, if they're not null
+  int decimals = (int)(hundredths % 100);
+  if (decimals != 0) {
+
+    *(ptr++) = '.';
+    *(ptr++) = (char)('0' + decimals / 10);
+    if (decimals % 10 != 0) {
+
+      *(ptr++) = (char)('0' + decimals % 10);
+
+    }
+
+  }
+
+  that->size = (size_t)(ptr - that->buffer);
 
 }
 
-// Create the image from the history
-// Return true if successfull, else false
-bool GAViewerHistoryToImg(GAViewer* const that) {
+// Write the text buffered in the SvgWriter 'that'
+void SvgWriterFlush(SvgWriter* const that) {
 
 #if BUILDMODE == 0
   if (that == NULL) {
@@ -491,384 +18196,429 @@ bool GAViewerHistoryToImg(GAViewer* const that) {
 
   }
 
-  if (that->pathHistoryImg == NULL) {
+#endif
+
+  if (
+    that->size > 0 &&
+    that->isFailed == false) {
+
+    size_t nbWritten =
+      fwrite(
+        that->buffer,
+        1,
+        that->size,
+        that->stream);
+    that->isFailed = (nbWritten != that->size);
+
+  }
+
+  that->size = 0;
+
+}
+
+// Write the text still buffered in the SvgWriter 'that' and close its
+// file
+// Return true if the whole file was written successfully, else false
+bool SvgWriterClose(SvgWriter* const that) {
+
+#if BUILDMODE == 0
+  if (that == NULL) {
 
     GAViewerErr->_type = PBErrTypeNullPointer;
     sprintf(
       GAViewerErr->_msg,
-      "'that->pathHistory' is null");
+      "'that' is null");
     PBErrCatch(GAViewerErr);
 
   }
 
 #endif
 
-  // Create the GenBrush
-  GenBrush* gb = GBCreateImage(&(that->dimHistoryImg));
+  SvgWriterFlush(that);
+  int ret = fclose(that->stream);
+  that->stream = NULL;
+  return
+    that->isFailed == false &&
+    ret == 0;
 
-  // Get the surface of the GenBrush
-  GBSurface* surf = GBSurf(gb);
+}
 
-  // Create the objects used to draw the genealogy
-  GBPixel colorEpoch = GBColorWhite;
-  colorEpoch._rgba[GBPixelRed] = 202;
-  colorEpoch._rgba[GBPixelGreen] = 202;
-  colorEpoch._rgba[GBPixelBlue] = 202;
-  GBInkSolid* inkEpoch = GBInkSolidCreate(&colorEpoch);
-  GBPixel colorBirth = GBColorBlack;
-  GBInkSolid* inkBirth = GBInkSolidCreate(&colorBirth);
-  GBPixel colorSurvive = GBColorRed;
-  GBInkSolid* inkSurvive = GBInkSolidCreate(&colorSurvive);
-  GBToolPlotter* tool = GBToolPlotterCreate();
-  GBEyeOrtho* eye = GBEyeOrthoCreate(GBEyeOrthoViewFront);
-  GBHand hand = GBHandCreateStatic(GBHandTypeDefault);
+// Create a static HistReader reading the stream 'stream'
+HistReader HistReaderCreateStatic(FILE* const stream) {
 
-  // Create the layer for the epochs
-  GBLayer* layerEpoch =
-    GBSurfaceAddLayer(
-      surf,
-      GBDim(gb));
-  GBLayerSetStackPos(
-    layerEpoch,
-    GBLayerStackPosFg);
-  GBLayerSetBlendMode(
-    layerEpoch,
-    GBLayerBlendModeOver);
+#if BUILDMODE == 0
+  if (stream == NULL) {
 
-  // Create the layer for the births
-  GBLayer* layerBirth =
-    GBSurfaceAddLayer(
-      surf,
-      GBDim(gb));
-  GBLayerSetStackPos(
-    layerEpoch,
-    GBLayerStackPosBg);
-  GBLayerSetBlendMode(
-    layerEpoch,
-    GBLayerBlendModeOver);
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'stream' is null");
+    PBErrCatch(GAViewerErr);
 
-  // Create a GSet to keep track of the curves
-  GSet curves = GSetCreateStatic();
+  }
 
-  // Create a GSet to keep track of the shapoids
-  GSet shapoids = GSetCreateStatic();
+#endif
 
-  // Vector to do computation
-  VecFloat3D v = VecFloatCreateStatic3D();
+  // Declare the new HistReader
+  HistReader that;
 
-  // Calculate the step along x between two epochs
-  float stepXEpoch =
-    (float)VecGet(
-      &(that->dimHistoryImg),
-      0) /
-    (float)(that->toEpoch - that->fromEpoch + 1);
+  // Init the properties
+  that.stream = stream;
+  that.nbByte = 0;
+  that.pos = 0;
+  that.offset = 0;
+  that.epochIndex = NULL;
+  that.isStopped = false;
+
+  // Return the new HistReader
+  return that;
 
-  // Calculate the bottom and top of the epoch curve
-  float yMinEpoch =
-    0.01 *
-    (float)VecGet(
-      &(that->dimHistoryImg),
-      1);
-  float yMaxEpoch =
-    0.99 *
-    (float)VecGet(
-      &(that->dimHistoryImg),
-      1);
+}
 
-  // Loop on epochs
-  for (
-    unsigned long iEpoch = that->fromEpoch;
-    iEpoch <= that->toEpoch && iEpoch < that->nbEpoch;
-    ++iEpoch) {
+// Get the next character of the HistReader 'that' without consuming it
+// Return EOF if there is no more data
+int HistReaderPeek(HistReader* const that) {
 
-    // Declare a variable to memorize the shifted index of epoch
-    // according to the first displlayed epoch
-    unsigned long jEpoch = iEpoch - that->fromEpoch;
+  // If the buffer has been fully consumed
+  if (that->pos >= that->nbByte) {
 
-    // Create the curve for the epoch
-    SCurve* curve =
-      SCurveCreate(
+    // Refill the buffer
+    that->offset += that->nbByte;
+    that->nbByte =
+      fread(
+        that->buffer,
         1,
-        3,
-        1);
-    GSetPush(
-      &curves,
-      curve);
+        HISTREADER_BUFSIZE,
+        that->stream);
+    that->pos = 0;
 
-    // Set the position of the control points
-    VecSet(
-      &v,
-      0,
-      stepXEpoch * ((float)jEpoch + 0.5));
-    VecSet(
-      &v,
-      1,
-      yMinEpoch);
-    SCurveSetCtrl(
-      curve,
-      0,
-      (VecFloat*)&v);
-    VecSet(
-      &v,
-      1,
-      yMaxEpoch);
-    SCurveSetCtrl(
-      curve,
-      1,
-      (VecFloat*)&v);
+    // If there is no more data
+    if (that->nbByte == 0) {
 
-    // Create the pod for this curve
-    GBObjPod* pod =
-      GBAddSCurve(
-        gb,
-        curve,
-        &eye,
-        &hand,
-        tool,
-        inkEpoch,
-        layerEpoch);
+      return EOF;
 
-    // Declare some parameters to calculate the position of the node
-    unsigned long iNode = 0;
-    unsigned long nbNode = GSetNbElem(that->nodes + iEpoch);
-    float stepYEpoch =
-      (float)VecGet(
-        &(that->dimHistoryImg),
-        1) /
-      (float)nbNode;
-    float radiusCircle = stepYEpoch * 0.25;
+    }
+
+  }
+
+  // Return the next character
+  return (unsigned char)(that->buffer[that->pos]);
+
+}
+
+// Skip the white spaces in the HistReader 'that'
+// Return the next character without consuming it
+int HistReaderSkipSpace(HistReader* const that) {
+
+  int c = HistReaderPeek(that);
+  while (
+    c == ' ' ||
+    c == '\n' ||
+    c == '\r' ||
+    c == '\t') {
+
+    ++(that->pos);
+    c = HistReaderPeek(that);
+
+  }
+
+  return c;
+
+}
+
+// Consume the next non white space character of the HistReader 'that'
+// if it's equal to 'c'
+// Return true if it was consumed, else false
+bool HistReaderExpect(
+  HistReader* const that,
+          const int c) {
+
+  if (HistReaderSkipSpace(that) == c) {
+
+    ++(that->pos);
+    return true;
+
+  }
+
+  return false;
+
+}
+
+// Read a string in the HistReader 'that' and copy it into 'str' of
+// size 'size', truncating it if necessary
+// Return true if successfull, else false
+bool HistReaderReadString(
+  HistReader* const that,
+        char* const str,
+       const size_t size) {
+
+  // The string must start with a quote
+  if (
+    HistReaderExpect(
+      that,
+      '"') == false) {
+
+    return false;
+
+  }
+
+  // Loop on the characters until the closing quote
+  size_t len = 0;
+  int c = HistReaderPeek(that);
+  while (c != '"') {
+
+    // If we reached the end of the file, the string is invalid
+    if (c == EOF) {
+
+      return false;
+
+    }
+
+    // Copy the character
+    if (len + 1 < size) {
+
+      str[len] = c;
+      ++len;
+
+    }
+
+    // Skip the escaped character if any
+    ++(that->pos);
+    if (c == '\\') {
+
+      if (HistReaderPeek(that) == EOF) {
 
-    // Loop on the birth for this epoch
-    GSetIterForward iter =
-      GSetIterForwardCreateStatic(that->nodes + iEpoch);
-    do {
+        return false;
 
-      // Get the node
-      Node* node = GSetIterGet(&iter);
+      }
 
-      // Calculate the position of the node
+      ++(that->pos);
 
-      VecSet(
-        &(node->pos),
-        0,
-        stepXEpoch * ((float)jEpoch + 0.5));
-      VecSet(
-        &(node->pos),
-        1,
-        stepYEpoch * ((float)iNode + 0.5));
+    }
 
-      // Create the circle for this node
-      Spheroid* circle = SpheroidCreate(2);
-      GSetPush(
-        &shapoids,
-        circle);
-      VecFloat2D w = VecFloatCreateStatic2D();
-      VecSet(
-        &w,
-        0,
-        radiusCircle);
-      VecSet(
-        &w,
-        1,
-        radiusCircle);
-      ShapoidScale(
-        circle,
-        (VecFloat*)&w);
-      VecSet(
-        &w,
-        0,
-        VecGet(
-          &(node->pos),
-          0));
-      VecSet(
-        &w,
-        1,
-        VecGet(
-          &(node->pos),
-          1));
-      ShapoidTranslate(
-        circle,
-        (VecFloat*)&w);
-      pod =
-        GBAddShapoid(
-          gb,
-          circle,
-          &eye,
-          &hand,
-          tool,
-          inkBirth,
-          layerBirth);
+    c = HistReaderPeek(that);
 
-      // If we are not on the first displayed epoch
-      if (jEpoch > 0) {
+  }
 
-        // Get the parent node
-        Node* father =
-          GAViewerSearchNode(
-            that,
-            iEpoch - 1,
-            node->parents[0]);
-
-        // If the node has a parent
-        if (father != NULL) {
-
-          // Create the curve bewteen the child and its parent
-          SCurve* curveBirth =
-            SCurveCreate(
-              3,
-              3,
-              1);
-          GSetPush(
-            &curves,
-            curveBirth);
-          SCurveSetCtrl(
-            curveBirth,
-            0,
-            (VecFloat*)&(node->pos));
+  // Consume the closing quote
+  ++(that->pos);
 
-          VecSet(
-            &v,
-            0,
-            stepXEpoch * ((float)jEpoch));
-          VecSet(
-            &v,
-            1,
-            stepYEpoch * ((float)iNode + 0.5));
+  // Terminate the copied string
+  if (size > 0) {
 
-          SCurveSetCtrl(
-            curveBirth,
-            1,
-            (VecFloat*)&v);
+    str[len] = '\0';
 
-          VecSet(
-            &v,
-            0,
-            stepXEpoch * ((float)jEpoch));
-          VecSet(
-            &v,
-            1,
-            VecGet(
-              &(father->pos),
-              1));
-          SCurveSetCtrl(
-            curveBirth,
-            2,
-            (VecFloat*)&v);
+  }
 
-          SCurveSetCtrl(
-            curveBirth,
-            3,
-            (VecFloat*)&(father->pos));
+  // Return the success code
+  return true;
+
+}
 
-          // Select the ink
-          GBInkSolid* inkCurve = inkBirth;
-          if (node->id == father->id) {
+// Read an unsigned integer, quoted or not, in the HistReader 'that'
+// and copy it into 'val'
+// Return true if successfull, else false
+bool HistReaderReadULong(
+      HistReader* const that,
+  unsigned long* const val) {
 
-            inkCurve = inkSurvive;
+  // Check if the value is quoted, as GenAlg does
+  bool isQuoted = (HistReaderSkipSpace(that) == '"');
 
-          }
+  // Fast path: if the whole value is in the buffer, decode it directly
+  // from the buffer. The longest unsigned long has 20 digits
+  if (that->pos + 23 < that->nbByte) {
 
-          // Create the pod for this curve
-          pod =
-            GBAddSCurve(
-              gb,
-              curveBirth,
-              &eye,
-              &hand,
-              tool,
-              inkCurve,
-              layerBirth);
+    const char* ptr = that->buffer + that->pos + (isQuoted ? 1 : 0);
+    const char* start = ptr;
+    unsigned long v = 0;
+    while (
+      ptr - start <= 20 &&
+      *ptr >= '0' &&
+      *ptr <= '9') {
 
-        }
+      // Reject the value if it doesn't fit in an unsigned long
+      unsigned long d = (unsigned long)(*ptr - '0');
+      if (v > (ULONG_MAX - d) / 10) {
+
+        fprintf(
+          stderr,
+          "Integer overflow in the history at byte %lu\n",
+          that->offset + (unsigned long)(ptr - that->buffer));
+        return false;
 
       }
 
-      // Increment the index of node
-      ++iNode;
+      v = v * 10 + d;
+      ++ptr;
 
-    } while (GSetIterStep(&iter));
+    }
 
-    // Unused variable
-    (void)pod;
+    if (
+      ptr == start ||
+      ptr - start > 20 ||
+      (isQuoted && *ptr != '"')) {
+
+      return false;
+
+    }
+
+    *val = v;
+    that->pos = ptr - that->buffer + (isQuoted ? 1 : 0);
+    return true;
 
   }
 
-  // Update the GenBrush
-  GBUpdate(gb);
+  // Slow path, the value may span over two buffers
+  if (isQuoted) {
 
-  // Save the GenBrush
-  GBSetFileName(
-    gb,
-    that->pathHistoryImg);
-  GBRender(gb);
-  printf(
-    "Saved image [%s]\n",
-    that->pathHistoryImg);
+    ++(that->pos);
 
-  // Free memory
-  while (GSetNbElem(&curves) > 0) {
+  }
 
-    free(GSetPop(&curves));
+  unsigned long v = 0;
+  unsigned int nbDigit = 0;
+  int c = HistReaderPeek(that);
+  while (c >= '0' && c <= '9') {
+
+    // Reject the value if it doesn't fit in an unsigned long
+    unsigned long d = (unsigned long)(c - '0');
+    if (v > (ULONG_MAX - d) / 10) {
+
+      fprintf(
+        stderr,
+        "Integer overflow in the history at byte %lu\n",
+        that->offset + that->pos);
+      return false;
+
+    }
+
+    v = v * 10 + d;
+    ++nbDigit;
+    ++(that->pos);
+    c = HistReaderPeek(that);
 
   }
 
-  while (GSetNbElem(&shapoids) > 0) {
+  if (
+    nbDigit == 0 ||
+    nbDigit > 20) {
 
-    free(GSetPop(&shapoids));
+    return false;
 
   }
 
-  GBInkSolidFree(&inkEpoch);
-  GBInkSolidFree(&inkBirth);
-  GBInkSolidFree(&inkSurvive);
-  GBToolPlotterFree(&tool);
-  GBEyeOrthoFree(&eye);
-  GBFree(&gb);
+  if (isQuoted) {
 
-  // Return the success code
+    if (c != '"') {
+
+      return false;
+
+    }
+
+    ++(that->pos);
+
+  }
+
+  *val = v;
   return true;
 
 }
 
-// Get the max id from the history
-unsigned long GAViewerHistoryGetMaxId(GAViewer* const that) {
+// Skip the next JSON value in the HistReader 'that'
+// Return true if successfull, else false
+bool HistReaderSkipValue(HistReader* const that) {
 
-#if BUILDMODE == 0
-  if (that == NULL) {
+  int c = HistReaderSkipSpace(that);
 
-    GAViewerErr->_type = PBErrTypeNullPointer;
-    sprintf(
-      GAViewerErr->_msg,
-      "'that' is null");
-    PBErrCatch(GAViewerErr);
+  // If the value is a string
+  if (c == '"') {
 
-  }
+    char dummy[1];
+    return
+      HistReaderReadString(
+        that,
+        dummy,
+        1);
 
-#endif
+  // Else, if the value is an object or an array
+  } else if (c == '{' || c == '[') {
 
-  // Get the max id of nodes
-  unsigned long maxId = 0;
-  GSetIterForward iter =
-    GSetIterForwardCreateStatic(&(that->history._genealogy));
-  do {
+    int close = (c == '{' ? '}' : ']');
+    ++(that->pos);
+    if (
+      HistReaderExpect(
+        that,
+        close)) {
 
-    // Get the current birth
-    GAHistoryBirth* birth = GSetIterGet(&iter);
+      return true;
 
-    // Update the max id
-    maxId =
-      MAX(
-        maxId,
-        birth->_idChild);
+    }
+
+    // Loop on the elements
+    do {
+
+      // Skip the key if it's an object
+      if (
+        close == '}' &&
+        (HistReaderSkipValue(that) == false ||
+        HistReaderExpect(
+          that,
+          ':') == false)) {
+
+        return false;
+
+      }
+
+      // Skip the element
+      if (HistReaderSkipValue(that) == false) {
+
+        return false;
+
+      }
+
+    } while (
+      HistReaderExpect(
+        that,
+        ','));
 
-  } while(GSetIterStep(&iter));
+    return
+      HistReaderExpect(
+        that,
+        close);
 
-  return maxId;
+  // Else, the value is a number or a literal
+  } else {
+
+    unsigned int len = 0;
+    while (
+      c != EOF &&
+      c != ',' &&
+      c != '}' &&
+      c != ']' &&
+      c != ' ' &&
+      c != '\n' &&
+      c != '\r' &&
+      c != '\t') {
+
+      ++len;
+      ++(that->pos);
+      c = HistReaderPeek(that);
+
+    }
+
+    return (len > 0);
+
+  }
 
 }
 
-// Get the nb of epoch from the history
-unsigned long GAViewerHistoryGetNbEpoch(GAViewer* const that) {
+// Read the array of births in the HistReader 'that' and add them
+// to the GAViewer 'viewer'
+// Return true if successfull, else false
+bool HistReaderReadGenealogy(
+  HistReader* const that,
+    GAViewer* const viewer) {
 
 #if BUILDMODE == 0
   if (that == NULL) {
@@ -881,31 +18631,55 @@ unsigned long GAViewerHistoryGetNbEpoch(GAViewer* const that) {
 
   }
 
+  if (viewer == NULL) {
+
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'viewer' is null");
+    PBErrCatch(GAViewerErr);
+
+  }
+
 #endif
 
-  // Get the nb of epochs
-  unsigned long nbEpoch = 0;
-  GSetIterForward iter =
-    GSetIterForwardCreateStatic(&(that->history._genealogy));
-  do {
+  // The genealogy is an array
+  if (
+    HistReaderExpect(
+      that,
+      '[') == false) {
 
-    // Get the current birth
-    GAHistoryBirth* birth = GSetIterGet(&iter);
+    return false;
 
-    // Update the number of epoch
-    nbEpoch =
-      MAX(
-        nbEpoch,
-        birth->_epoch);
+  }
+
+  // If the array is empty
+  if (
+    HistReaderExpect(
+      that,
+      ']')) {
 
-  } while(GSetIterStep(&iter));
+    return true;
 
-  return nbEpoch + 1;
+  }
+
+  // Read the births and the end of the array
+  return
+    HistReaderReadBirths(
+      that,
+      viewer) &&
+    HistReaderExpect(
+      that,
+      ']');
 
 }
 
-// Create the nodes from the history
-void GAViewerHistoryToNodes(GAViewer* const that) {
+// Read the births in the HistReader 'that', up to the end of the
+// genealogy array excluded, and add them to the GAViewer 'viewer'
+// Return true if successfull, else false
+bool HistReaderReadBirths(
+  HistReader* const that,
+    GAViewer* const viewer) {
 
 #if BUILDMODE == 0
   if (that == NULL) {
@@ -918,202 +18692,177 @@ void GAViewerHistoryToNodes(GAViewer* const that) {
 
   }
 
-#endif
+  if (viewer == NULL) {
 
-  // Get the number of epoch
-  that->nbEpoch = GAViewerHistoryGetNbEpoch(that);
+    GAViewerErr->_type = PBErrTypeNullPointer;
+    sprintf(
+      GAViewerErr->_msg,
+      "'viewer' is null");
+    PBErrCatch(GAViewerErr);
 
-  // Allocate memory for the nodes
-  that->nodes =
-    PBErrMalloc(
-      GAViewerErr,
-      sizeof(GSet) * (that->nbEpoch));
+  }
 
-  // Initialize the sets of nodes per epoch
-  for (
-    unsigned long iEpoch = that->nbEpoch;
-    iEpoch--;) {
+#endif
 
-    that->nodes[iEpoch] = GSetCreateStatic();
+  // Loop on the births
+  do {
 
-  }
+    // Memorize the position of the birth
+    HistReaderSkipSpace(that);
+    uint64_t offsetBirth = that->offset + that->pos;
 
-  // Loop on the birth
-  GSetIterForward iter =
-    GSetIterForwardCreateStatic(&(that->history._genealogy));
-  do {
+    // The birth is an object
+    if (
+      HistReaderExpect(
+        that,
+        '{') == false) {
 
-    // Get the current birth
-    GAHistoryBirth* birth = GSetIterGet(&iter);
+      return false;
 
-    // Create a node
-    Node* node =
-      PBErrMalloc(
-        GAViewerErr,
-        sizeof(Node));
+    }
 
-    // Set the properties of the node according to the birth
-    node->epoch = birth->_epoch;
-    node->id = birth->_idChild;
-    node->parents[0] = birth->_idParents[0];
-    node->parents[1] = birth->_idParents[1];
-    node->pos = VecFloatCreateStatic3D();
+    // Declare variables to memorize the properties of the birth
+    // and the ones which have been found
+    unsigned long epoch = 0;
+    unsigned long father = 0;
+    unsigned long mother = 0;
+    unsigned long id = 0;
+    int found = 0;
 
-    // Add the node to the set of its epoch
-    GSetAppend(
-      (GSet*)(that->nodes + node->epoch),
-      node);
+    // Loop on the properties of the birth
+    if (
+      HistReaderExpect(
+        that,
+        '}') == false) {
 
-  } while(GSetIterStep(&iter));
+      do {
 
-  // Display some info to the user
-  printf(
-    "Decoded %ld epochs\n",
-    that->nbEpoch);
+        // Read the key
+        char key[HISTREADER_KEYLENMAX];
+        if (
+          HistReaderReadString(
+            that,
+            key,
+            HISTREADER_KEYLENMAX) == false ||
+          HistReaderExpect(
+            that,
+            ':') == false) {
 
-  // Loop on the epoch
-  for (
-    unsigned long iEpoch = 0;
-    iEpoch < that->nbEpoch;
-    ++iEpoch) {
+          return false;
 
-    // Display some info to the user
-    printf(
-      "Number of nodes in epoch #%ld :%ld\n",
-      iEpoch,
-      GSetNbElem(
-        that->nodes + iEpoch));
+        }
 
-    // Loop on the nodes at this epoch
-    GSetIterForward iterNode =
-      GSetIterForwardCreateStatic(that->nodes + iEpoch);
-    unsigned long iNode = 0;
-    do {
+        // Read the value according to the key
+        bool ret = true;
+        if (strcmp(key, "_epoch") == 0) {
 
-      // Get the node
-      Node* node = GSetIterGet(&iterNode);
+          ret =
+            HistReaderReadULong(
+              that,
+              &epoch);
+          found |= 1;
 
-      // If we are at the first epoch
-      if (iEpoch == 0) {
+        } else if (strcmp(key, "_father") == 0) {
 
-        // Set the sort value of the node to its position
-        node->rank = iNode;
-        GSetIterSetSortVal(
-          &iterNode,
-          iNode);
+          ret =
+            HistReaderReadULong(
+              that,
+              &father);
+          found |= 2;
 
-      // Else, we are not at the first epoch
-      } else {
+        } else if (strcmp(key, "_mother") == 0) {
 
-        // Search the parent
-        Node* father =
-          GAViewerSearchNode(
-            that,
-            iEpoch - 1,
-            node->parents[0]);
+          ret =
+            HistReaderReadULong(
+              that,
+              &mother);
+          found |= 4;
 
-        // If there is a father
-        if (father != NULL) {
+        } else if (strcmp(key, "_id") == 0) {
 
-          // Set the sort value of the node to the rank of the parent
-          GSetIterSetSortVal(
-            &iterNode,
-            father->rank);
+          ret =
+            HistReaderReadULong(
+              that,
+              &id);
+          found |= 8;
 
-        // Else, there is no father
         } else {
 
-          // Set the sort value of the node to the nb of nodes in the
-          // epoch
-          GSetIterSetSortVal(
-            &iterNode,
-            GSetNbElem(that->nodes + iEpoch));
+          ret = HistReaderSkipValue(that);
 
         }
 
-      }
-
-      // Increment the index of node
-      ++iNode;
-
-    } while(GSetIterStep(&iterNode));
-
-    // Sort the nodes of the current epoch
-    GSetSort(that->nodes + iEpoch);
-
-    // Loop again on the nodes
-    GSetIterReset(&iterNode);
-    iNode = 0;
-    do {
-
-      // Get the node
-      Node* node = GSetIterGet(&iterNode);
-
-      // Set the rank of the node to its position
-      node->rank = iNode;
+        if (ret == false) {
 
-      // Increment the index of node
-      ++iNode;
+          return false;
 
-    } while(GSetIterStep(&iterNode));
+        }
 
-  }
+      } while (
+        HistReaderExpect(
+          that,
+          ','));
 
-}
+      if (
+        HistReaderExpect(
+          that,
+          '}') == false) {
 
-// Search a node based on its id at a given epoch
-Node* GAViewerSearchNode(
-  const GAViewer* const that,
-          unsigned long epoch,
-          unsigned long id) {
+        return false;
 
-#if BUILDMODE == 0
-  if (that == NULL) {
+      }
 
-    GAViewerErr->_type = PBErrTypeNullPointer;
-    sprintf(
-      GAViewerErr->_msg,
-      "'that' is null");
-    PBErrCatch(GAViewerErr);
+    }
 
-  }
+    // If one of the properties is missing, the birth is invalid
+    if (found != 15) {
 
-  if (epoch >= that->nbEpoch) {
+      return false;
 
-    GAViewerErr->_type = PBErrTypeInvalidArg;
-    sprintf(
-      GAViewerErr->_msg,
-      "'epoch' is invalid (%ld< %ld)",
-      epoch,
-      that->nbEpoch);
-    PBErrCatch(GAViewerErr);
+    }
 
-  }
+    // Update the index of epochs if any
+    if (that->epochIndex != NULL) {
 
-#endif
+      EpochIndexAddBirth(
+        that->epochIndex,
+        epoch,
+        offsetBirth,
+        id);
 
-  // Declare a pointer to the searched node
-  Node* node = NULL;
+    // Else, if the births are read from an index of epochs, stop at
+    // the first one beyond the range of loaded epochs
+    } else if (epoch > viewer->loadToEpoch) {
 
-  // Loop on the node of the epoch
-  GSetIterForward iter = GSetIterForwardCreateStatic(that->nodes + epoch);
-  do {
+      that->isStopped = true;
+      return true;
 
-    // Get the node
-    Node* n = GSetIterGet(&iter);
+    }
 
-    // If this is the searched node
-    if (n->id == id) {
+    // Add the birth to the viewer
+    bool retAdd =
+      GAViewerAddNode(
+        viewer,
+        epoch,
+        father,
+        mother,
+        id);
+    if (retAdd == false) {
 
-      // Memorize the found ndoe
-      node = n;
+      return false;
 
     }
 
-  } while (node == NULL && GSetIterForwardStep(&iter));
+    // Memorize the end of the last read birth
+    viewer->offsetLastBirth = that->offset + that->pos;
 
-  // Return the found node
-  return node;
+  } while (
+    HistReaderExpect(
+      that,
+      ','));
+
+  // Return the success code
+  return true;
 
 }
 
@@ -1152,6 +18901,9 @@ int main(
 
   }
 
+  // Print the statistics if requested
+  StatsPrint(stdout);
+
   // Free the instance of GAViewer
   GAViewerFree(&viewer);
 